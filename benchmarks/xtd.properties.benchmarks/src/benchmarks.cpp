@@ -0,0 +1,405 @@
+#include <xtd/properties>
+#include <xtd/cow_property.h>
+#include <xtd/property_format.h>
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace xtd;
+
+namespace benchmarks {
+  struct result {
+    std::string variant;
+    std::string type;
+    std::string operation;
+    double nanoseconds = 0;
+    std::size_t size = 0;
+  };
+
+  std::vector<result>& results() {
+    static std::vector<result> results;
+    return results;
+  }
+
+  template <class type_t>
+  inline void do_not_optimize(const type_t& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static const void* volatile sink = nullptr;
+    sink = &value;
+#endif
+  }
+
+  // Runs function iterations times per round and keeps the fastest round, in nanoseconds per iteration.
+  template <class function_t>
+  double measure(std::size_t iterations, function_t function) {
+    constexpr auto rounds = 5;
+    auto best = std::chrono::nanoseconds::max();
+    for (auto round = 0; round < rounds; ++round) {
+      auto start = std::chrono::steady_clock::now();
+      function(iterations);
+      best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start));
+    }
+    return static_cast<double>(best.count()) / static_cast<double>(iterations);
+  }
+
+  template <class type_t> const char* type_name();
+  template <> const char* type_name<int>() {return "int";}
+  template <> const char* type_name<double>() {return "double";}
+  template <> const char* type_name<std::string>() {return "std::string";}
+  template <> const char* type_name<std::vector<int>>() {return "std::vector<int>";}
+
+  // A pool of distinct values, so that the compiler cannot hoist the work out of the loops.
+  template <class type_t>
+  struct values {
+    static constexpr std::size_t count = 16;
+
+    values() {
+      for (auto index = 0u; index < count; ++index) {
+        if constexpr (std::is_arithmetic<type_t>::value) items[index] = static_cast<type_t>(index);
+        else if constexpr (std::is_same<type_t, std::string>::value) items[index] = std::string(24, static_cast<char>('a' + index));
+        else items[index] = type_t(16, static_cast<int>(index));
+      }
+      if constexpr (std::is_arithmetic<type_t>::value) increment = 1;
+      else if constexpr (std::is_same<type_t, std::string>::value) increment = "x";
+      else increment = type_t {1};
+    }
+
+    const type_t& operator[](std::size_t index) const {return items[index % count];}
+
+    type_t items[count];
+    type_t increment;
+  };
+
+  // The compound operation : += for arithmetic types and std::string, append for std::vector.
+  template <class type_t>
+  void append(type_t& target, const type_t& value) {
+    if constexpr (std::is_same<type_t, std::vector<int>>::value) target.insert(target.end(), value.begin(), value.end());
+    else target += value;
+  }
+
+  template <class property_t, class type_t>
+  void append_to_property(property_t& target, const type_t& value) {
+    if constexpr (std::is_same<type_t, std::vector<int>>::value) target.modify([&](type_t& items) {append(items, value);});
+    else target += value;
+  }
+
+  template <class type_t>
+  struct field_variant {
+    static constexpr const char* name = "field";
+    static constexpr bool can_get = true;
+    static constexpr bool can_set = true;
+
+    struct owner {
+      type_t value {};
+    };
+
+    static const type_t& get(const owner& o) {return o.value;}
+    static void set(owner& o, const type_t& value) {o.value = value;}
+    static void compound(owner& o, const type_t& value) {append(o.value, value);}
+  };
+
+  template <class type_t>
+  struct methods_variant {
+    static constexpr const char* name = "methods";
+    static constexpr bool can_get = true;
+    static constexpr bool can_set = true;
+
+    class owner {
+    public:
+      const type_t& value() const {return value_;}
+      void value(const type_t& value) {value_ = value;}
+
+    private:
+      type_t value_ {};
+    };
+
+    static const type_t& get(const owner& o) {return o.value();}
+    static void set(owner& o, const type_t& value) {o.value(value);}
+    static void compound(owner& o, const type_t& value) {
+      auto result = o.value();
+      append(result, value);
+      o.value(result);
+    }
+  };
+
+  template <class type_t>
+  struct readwrite_variant {
+    static constexpr const char* name = "readwrite_";
+    static constexpr bool can_get = true;
+    static constexpr bool can_set = true;
+
+    class owner {
+    public:
+      owner() = default;
+      owner(const owner& o) : value_(o.value_) {}
+
+      property_<type_t> value {
+        get_ {return value_;},
+        set_ {value_ = std::forward<decltype(value)>(value);}
+      };
+
+    private:
+      type_t value_ {};
+    };
+
+    static const type_t& get(const owner& o) {return o.value.get();}
+    static void set(owner& o, const type_t& value) {o.value = value;}
+    static void compound(owner& o, const type_t& value) {append_to_property(o.value, value);}
+  };
+
+  template <class type_t>
+  struct readonly_variant {
+    static constexpr const char* name = "readonly_";
+    static constexpr bool can_get = true;
+    static constexpr bool can_set = false;
+
+    class owner {
+    public:
+      owner() = default;
+      owner(const owner& o) : value_(o.value_) {}
+
+      property_<type_t, readonly_> value {
+        get_ {return value_;}
+      };
+
+    private:
+      type_t value_ {};
+    };
+
+    static const type_t& get(const owner& o) {return o.value.get();}
+  };
+
+  template <class type_t>
+  struct writeonly_variant {
+    static constexpr const char* name = "writeonly_";
+    static constexpr bool can_get = false;
+    static constexpr bool can_set = true;
+
+    class owner {
+    public:
+      owner() = default;
+      owner(const owner& o) : value_(o.value_) {}
+
+      property_<type_t, writeonly_> value {
+        set_ {value_ = std::forward<decltype(value)>(value);}
+      };
+
+    private:
+      type_t value_ {};
+    };
+
+    static void set(owner& o, const type_t& value) {o.value = value;}
+  };
+
+  template <class type_t>
+  struct auto_variant {
+    static constexpr const char* name = "auto";
+    static constexpr bool can_get = true;
+    static constexpr bool can_set = true;
+
+    struct owner {
+      property_<type_t> value;
+    };
+
+    static const type_t& get(const owner& o) {return o.value.get();}
+    static void set(owner& o, const type_t& value) {o.value = value;}
+    static void compound(owner& o, const type_t& value) {append_to_property(o.value, value);}
+  };
+
+  template <class type_t>
+  struct cow_variant {
+    static constexpr const char* name = "cow";
+    static constexpr bool can_get = true;
+    static constexpr bool can_set = true;
+
+    struct owner {
+      property_<type_t, cow_> value;
+    };
+
+    static const type_t& get(const owner& o) {return o.value.get();}
+    static void set(owner& o, const type_t& value) {o.value = value;}
+    static void compound(owner& o, const type_t& value) {append_to_property(o.value, value);}
+  };
+
+  template <class type_t>
+  struct member_variant {
+    static constexpr const char* name = "member_property_";
+    static constexpr bool can_get = true;
+    static constexpr bool can_set = true;
+
+    class owner {
+    private:
+      type_t value_ {};
+
+    public:
+      member_property_(owner, value, type_t, &owner::value_, &owner::value_);
+    };
+
+    static const type_t& get(const owner& o) {return o.value.get();}
+    static void set(owner& o, const type_t& value) {o.value = value;}
+    static void compound(owner& o, const type_t& value) {append_to_property(o.value, value);}
+  };
+
+  template <template <class> class variant_t, class type_t>
+  void run(std::size_t iterations) {
+    using variant = variant_t<type_t>;
+    using owner = typename variant::owner;
+    auto add = [&](const char* operation, double nanoseconds) {results().push_back({variant::name, type_name<type_t>(), operation, nanoseconds, sizeof(owner)});};
+    values<type_t> pool;
+
+    if constexpr (variant::can_get) add("get", measure(iterations, [&](std::size_t count) {
+      owner o;
+      for (auto index = 0u; index < count; ++index)
+        do_not_optimize(variant::get(o));
+    }));
+
+    if constexpr (variant::can_set) add("set", measure(iterations, [&](std::size_t count) {
+      owner o;
+      for (auto index = 0u; index < count; ++index) {
+        variant::set(o, pool[index]);
+        do_not_optimize(o);
+      }
+    }));
+
+    if constexpr (variant::can_get && variant::can_set) add("compound", measure(iterations, [&](std::size_t count) {
+      owner o;
+      for (auto index = 0u; index < count; ++index) {
+        if (index % 1024 == 0) variant::set(o, pool[index]);
+        variant::compound(o, pool.increment);
+        do_not_optimize(o);
+      }
+    }));
+
+    add("copy", measure(iterations, [&](std::size_t count) {
+      owner source;
+      for (auto index = 0u; index < count; ++index) {
+        owner copy(source);
+        do_not_optimize(copy);
+      }
+    }));
+
+    add("construct", measure(iterations, [&](std::size_t count) {
+      for (auto index = 0u; index < count; ++index) {
+        owner o;
+        do_not_optimize(o);
+      }
+    }));
+  }
+
+  template <class type_t>
+  void run_all(std::size_t iterations) {
+    run<field_variant, type_t>(iterations);
+    run<methods_variant, type_t>(iterations);
+    run<readwrite_variant, type_t>(iterations);
+    run<readonly_variant, type_t>(iterations);
+    run<writeonly_variant, type_t>(iterations);
+    run<auto_variant, type_t>(iterations);
+    run<cow_variant, type_t>(iterations);
+    run<member_variant, type_t>(iterations);
+  }
+
+  // The text of a raw value, the baseline of the format operation.
+  template <class type_t>
+  std::to_chars_result raw_to_chars(char* first, char* last, const type_t& value) {
+    if constexpr (std::is_arithmetic<type_t>::value) return std::to_chars(first, last, value);
+    else {
+      if (static_cast<std::size_t>(last - first) < value.size()) return {last, std::errc::value_too_large};
+      std::memcpy(first, value.data(), value.size());
+      return {first + value.size(), std::errc {}};
+    }
+  }
+
+  // Formats a property_ as text : operator<< into a reused std::ostringstream against to_chars_ into a char buffer.
+  template <class type_t>
+  void run_format(std::size_t iterations) {
+    values<type_t> pool;
+    property_<type_t> properties[values<type_t>::count];
+    for (auto index = 0u; index < values<type_t>::count; ++index)
+      properties[index] = pool[index];
+    auto add = [&](const char* variant, double nanoseconds) {results().push_back({variant, type_name<type_t>(), "format", nanoseconds, sizeof(property_<type_t>)});};
+
+    add("field", measure(iterations, [&](std::size_t count) {
+      char buffer[64];
+      for (auto index = 0u; index < count; ++index) {
+        auto result = raw_to_chars(buffer, buffer + sizeof(buffer), pool[index]);
+        do_not_optimize(result.ptr);
+        do_not_optimize(buffer);
+      }
+    }));
+
+    add("operator<<", measure(iterations, [&](std::size_t count) {
+      std::ostringstream os;
+      for (auto index = 0u; index < count; ++index) {
+        os.seekp(0);
+        os << properties[index % values<type_t>::count];
+        do_not_optimize(os);
+      }
+    }));
+
+    add("to_chars_", measure(iterations, [&](std::size_t count) {
+      char buffer[64];
+      for (auto index = 0u; index < count; ++index) {
+        auto result = to_chars_(buffer, buffer + sizeof(buffer), properties[index % values<type_t>::count]);
+        do_not_optimize(result.ptr);
+        do_not_optimize(buffer);
+      }
+    }));
+  }
+
+  const result* baseline(const result& r) {
+    auto iterator = std::find_if(results().begin(), results().end(), [&](const result& other) {return other.variant == "field" && other.type == r.type && other.operation == r.operation;});
+    return iterator == results().end() ? nullptr : &*iterator;
+  }
+
+  void print(std::ostream& os) {
+    os << std::left << std::setw(18) << "variant" << std::setw(18) << "type" << std::setw(11) << "operation" << std::right << std::setw(12) << "ns/op" << std::setw(12) << "vs field" << std::setw(8) << "sizeof" << std::endl;
+    for (const auto& r : results()) {
+      auto base = baseline(r);
+      os << std::left << std::setw(18) << r.variant << std::setw(18) << r.type << std::setw(11) << r.operation << std::right << std::fixed << std::setprecision(3) << std::setw(12) << r.nanoseconds;
+      if (base && base->nanoseconds > 0) os << std::setw(11) << r.nanoseconds / base->nanoseconds << "x";
+      else os << std::setw(12) << "-";
+      os << std::setw(8) << r.size << std::endl;
+    }
+  }
+
+  void write_json(std::ostream& os) {
+    os << "{\n  \"results\": [\n";
+    for (auto index = 0u; index < results().size(); ++index) {
+      const auto& r = results()[index];
+      auto base = baseline(r);
+      os << "    {\"variant\": \"" << r.variant << "\", \"type\": \"" << r.type << "\", \"operation\": \"" << r.operation << "\", \"ns_per_op\": " << std::setprecision(6) << r.nanoseconds;
+      if (base && base->nanoseconds > 0) os << ", \"relative_to_field\": " << r.nanoseconds / base->nanoseconds;
+      os << ", \"sizeof_owner\": " << r.size << "}" << (index + 1 == results().size() ? "\n" : ",\n");
+    }
+    os << "  ]\n}\n";
+  }
+}
+
+// usage : xtd.properties.benchmarks [output.json]
+int main(int argc, char* argv[]) {
+  benchmarks::run_all<int>(1 << 22);
+  benchmarks::run_all<double>(1 << 22);
+  benchmarks::run_all<std::string>(1 << 18);
+  benchmarks::run_all<std::vector<int>>(1 << 16);
+  benchmarks::run_format<int>(1 << 20);
+  benchmarks::run_format<double>(1 << 20);
+  benchmarks::run_format<std::string>(1 << 20);
+
+  benchmarks::print(std::cout);
+
+  auto output = argc > 1 ? argv[1] : "xtd.properties.benchmarks.json";
+  std::ofstream file(output);
+  benchmarks::write_json(file);
+  std::cout << std::endl << "Results written to " << output << std::endl;
+  return file ? 0 : 1;
+}
@@ -28,7 +28,7 @@ public:
 
   property_<std::shared_ptr<::Writer>, writeonly_> Writer {
     set_ {
-      this->writer = value;
+      this->writer = std::forward<decltype(value)>(value);
       this->writer->WriteLine("set new Writer...");
     }
   };
@@ -0,0 +1,235 @@
+/// @file
+/// @brief Contains atomic_ attribute and property_<type_t, atomic_> class.
+#pragma once
+
+#include "properties.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+// The property_ keyword is suspended while this header specializes the property_ class.
+#pragma push_macro("property_")
+#undef property_
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief atomic_ struct represent a property_ read write attribute that can be read and written concurrently from several threads.
+  struct atomic_ : public readwrite_ {};
+
+  /// @cond
+  namespace detail {
+    template <class type_t, bool lock_free = std::atomic<type_t>::is_always_lock_free>
+    class atomic_value_;
+
+    // The value of an atomic_ property_ that std::atomic handles without lock.
+    template <class type_t>
+    class atomic_value_<type_t, true> {
+    public:
+      atomic_value_() = default;
+      explicit atomic_value_(const type_t& value) noexcept : value(value) {}
+
+      type_t load() const noexcept {return value.load(std::memory_order_acquire);}
+      void store(const type_t& new_value) noexcept {value.store(new_value, std::memory_order_release);}
+      type_t exchange(const type_t& new_value) noexcept {return value.exchange(new_value, std::memory_order_acq_rel);}
+
+      template <class operator_t>
+      void compound(const type_t& operand) noexcept {
+        if constexpr (std::is_integral<type_t>::value && !std::is_same<type_t, bool>::value && std::is_same<operator_t, add_>::value) value.fetch_add(operand, std::memory_order_acq_rel);
+        else if constexpr (std::is_integral<type_t>::value && !std::is_same<type_t, bool>::value && std::is_same<operator_t, subtract_>::value) value.fetch_sub(operand, std::memory_order_acq_rel);
+        else if constexpr (std::is_integral<type_t>::value && !std::is_same<type_t, bool>::value && std::is_same<operator_t, bit_and_>::value) value.fetch_and(operand, std::memory_order_acq_rel);
+        else if constexpr (std::is_integral<type_t>::value && !std::is_same<type_t, bool>::value && std::is_same<operator_t, bit_or_>::value) value.fetch_or(operand, std::memory_order_acq_rel);
+        else if constexpr (std::is_integral<type_t>::value && !std::is_same<type_t, bool>::value && std::is_same<operator_t, bit_xor_>::value) value.fetch_xor(operand, std::memory_order_acq_rel);
+        else modify(compound_<operator_t, type_t> {operand});
+      }
+
+      template <class function_t>
+      void modify(function_t&& function) {
+        auto expected = value.load(std::memory_order_relaxed);
+        auto desired = expected;
+        do {
+          desired = expected;
+          function(desired);
+        } while (!value.compare_exchange_weak(expected, desired, std::memory_order_acq_rel, std::memory_order_relaxed));
+      }
+
+    private:
+      std::atomic<type_t> value {};
+    };
+
+    // The value of an atomic_ property_ too large for a lock-free std::atomic : a sequence lock. The value is kept in relaxed atomic words so that a read racing a write is well defined ; the reader retries when the sequence changed.
+    template <class type_t>
+    class atomic_value_<type_t, false> {
+      using word_type = std::uintptr_t;
+      static constexpr std::size_t word_count = (sizeof(type_t) + sizeof(word_type) - 1) / sizeof(word_type);
+
+    public:
+      atomic_value_() : atomic_value_(type_t {}) {}
+      explicit atomic_value_(const type_t& value) noexcept {write(value);}
+
+      type_t load() const noexcept {
+        word_type buffer[word_count];
+        for (;;) {
+          auto sequence_before = sequence.load(std::memory_order_acquire);
+          if (sequence_before & 1) continue;
+          for (auto index = std::size_t {0}; index < word_count; ++index)
+            buffer[index] = words[index].load(std::memory_order_relaxed);
+          std::atomic_thread_fence(std::memory_order_acquire);
+          if (sequence.load(std::memory_order_relaxed) == sequence_before) return from_words(buffer);
+        }
+      }
+
+      void store(const type_t& new_value) noexcept {
+        auto sequence_before = lock();
+        write(new_value);
+        unlock(sequence_before);
+      }
+
+      type_t exchange(const type_t& new_value) noexcept {
+        auto sequence_before = lock();
+        auto old_value = read();
+        write(new_value);
+        unlock(sequence_before);
+        return old_value;
+      }
+
+      template <class operator_t>
+      void compound(const type_t& operand) {modify(compound_<operator_t, type_t> {operand});}
+
+      template <class function_t>
+      void modify(function_t&& function) {
+        unlock_guard guard {*this, lock()};
+        auto value = read();
+        function(value);
+        write(value);
+      }
+
+    private:
+      static type_t from_words(const word_type* buffer) noexcept {
+        union result_type {
+          result_type() noexcept {}
+          unsigned char bytes;
+          type_t value;
+        } result;
+        std::memcpy(static_cast<void*>(&result.value), buffer, sizeof(type_t));
+        return result.value;
+      }
+
+      std::size_t lock() noexcept {
+        auto sequence_before = sequence.load(std::memory_order_relaxed);
+        for (;;) {
+          if ((sequence_before & 1) == 0 && sequence.compare_exchange_weak(sequence_before, sequence_before + 1, std::memory_order_acquire, std::memory_order_relaxed)) break;
+          std::this_thread::yield();
+          sequence_before = sequence.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        return sequence_before;
+      }
+
+      void unlock(std::size_t sequence_before) noexcept {sequence.store(sequence_before + 2, std::memory_order_release);}
+
+      // Ends the write even when the function given to modify() throws ; the value is then left unchanged.
+      struct unlock_guard {
+        ~unlock_guard() {value.unlock(sequence_before);}
+        atomic_value_& value;
+        std::size_t sequence_before;
+      };
+
+      type_t read() const noexcept {
+        word_type buffer[word_count];
+        for (auto index = std::size_t {0}; index < word_count; ++index)
+          buffer[index] = words[index].load(std::memory_order_relaxed);
+        return from_words(buffer);
+      }
+
+      void write(const type_t& value) noexcept {
+        word_type buffer[word_count] = {};
+        std::memcpy(buffer, static_cast<const void*>(&value), sizeof(type_t));
+        for (auto index = std::size_t {0}; index < word_count; ++index)
+          words[index].store(buffer[index], std::memory_order_relaxed);
+      }
+
+      std::atomic<std::size_t> sequence {0};
+      std::atomic<word_type> words[word_count] {};
+    };
+  }
+  /// @endcond
+
+  /// @brief An atomic_ property_ is a read write property_ that can be read and written concurrently from several threads without an external mutex.
+  /// @remarks The type must be trivially copyable. When std::atomic<type_t> is always lock free, the value is a std::atomic and the +=, -=, &=, |= and ^= operators of integral types map to fetch_add, fetch_sub, fetch_and, fetch_or and fetch_xor ; the other compound operators and modify() use a compare and swap loop. Other types are protected by a sequence lock : a read never blocks nor writes, it only retries while a write is in progress, and writes are serialized.
+  /// @remarks Because another thread may change the value at any time, get() returns the value, not a reference. Reads have acquire semantics and writes release semantics, so a value published through an atomic_ property_ makes the writes done before it visible to the reader.
+  /// @par Examples
+  /// @code
+  /// class worker {
+  /// public:
+  ///   property_<bool, atomic_> running {true};
+  ///   property_<std::size_t, atomic_> processed;
+  /// };
+  ///
+  /// worker w;
+  /// std::thread thread([&] {while (w.running) w.processed += 1;});
+  /// w.running = false;
+  /// thread.join();
+  /// @endcode
+  template <class type_t>
+  class property_<type_t, atomic_> : public atomic_ {
+    static_assert(std::is_trivially_copyable<type_t>::value, "The type of an atomic_ property_ must be trivially copyable.");
+
+  public:
+    /// @brief Gets whether the property_ is backed by a lock-free std::atomic (true) or by a sequence lock (false).
+    static constexpr bool is_lock_free = std::atomic<type_t>::is_always_lock_free;
+
+    /// @brief This method is an accessor method that retrieves the value of the property_.
+    type_t get() const noexcept {return storage.load();}
+
+    /// @brief This operator is an accessor operator that retrieves the value of the property_.
+    type_t operator()() const noexcept {return storage.load();}
+
+    /// @brief This method is an accessor method that assigns the value of the property_.
+    void set(const type_t& value) noexcept {storage.store(value);}
+
+    /// @brief This operator is an accessor operator that assigns the value of the property_.
+    void operator()(const type_t& value) noexcept {storage.store(value);}
+
+    /// @brief Assigns the value of the property_ and returns the previous value, atomically.
+    type_t exchange(const type_t& value) noexcept {return storage.exchange(value);}
+
+    /// @brief Lets function modify a copy of the value of the property_ and stores it atomically. With a lock-free std::atomic, function may be called several times.
+    template <class function_t>
+    void modify(function_t&& function) {storage.modify(std::forward<function_t>(function));}
+
+    /// @cond
+    property_() = default;
+    property_(const type_t& value) noexcept : storage(value) {}
+    property_(const property_& property) noexcept : storage(property.get()) {}
+
+    operator type_t() const noexcept {return get();}
+    property_& operator=(const property_& other) noexcept {set(other.get()); return *this;}
+    bool operator==(const type_t& value) const {return get() == value;}
+    bool operator!=(const type_t& value) const {return get() != value;}
+
+    property_& operator=(const type_t& value) noexcept {set(value); return *this;}
+    void operator+=(const type_t& value) {storage.template compound<detail::add_>(value);}
+    void operator-=(const type_t& value) {storage.template compound<detail::subtract_>(value);}
+    void operator*=(const type_t& value) {storage.template compound<detail::multiply_>(value);}
+    void operator /=(const type_t& value) {storage.template compound<detail::divide_>(value);}
+    void operator %=(const type_t& value) {storage.template compound<detail::modulus_>(value);}
+    void operator &=(const type_t& value) {storage.template compound<detail::bit_and_>(value);}
+    void operator |=(const type_t& value) {storage.template compound<detail::bit_or_>(value);}
+    void operator ^=(const type_t& value) {storage.template compound<detail::bit_xor_>(value);}
+    void operator<<=(const type_t& value) {storage.template compound<detail::left_shift_>(value);}
+    void operator>>=(const type_t& value) {storage.template compound<detail::right_shift_>(value);}
+
+    friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
+    /// @endcond
+
+  private:
+    detail::atomic_value_<type_t> storage;
+  };
+}
+
+#pragma pop_macro("property_")
+
+/// @brief #atomic_ represent a property_ read write attribute that can be read and written concurrently from several threads.
+/// @ingroup keywords
+#define atomic_ \
+  xtd::atomic_
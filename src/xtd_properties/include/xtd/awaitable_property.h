@@ -0,0 +1,256 @@
+/// @file
+/// @brief Contains awaitable_ attribute and property_<type_t, awaitable_> class.
+/// @remarks The awaitable_ property_ needs C++20 coroutines ; with an older standard this header declares nothing.
+#pragma once
+
+#include "properties.h"
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+
+// The property_ keyword is suspended while this header specializes the property_ class.
+#pragma push_macro("property_")
+#undef property_
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief awaitable_ struct represent a property_ read write attribute for a property_ whose changes can be awaited by coroutines.
+  struct awaitable_ : public readwrite_ {};
+
+  /// @brief An awaitable_ property_ is a read write auto-property whose changes can be awaited : co_await p.changed() resumes the coroutine on the next write, co_await p.until(predicate) when a write gives a value that matches predicate.
+  /// @remarks A waiting coroutine is parked in a list of awaiters that live in the coroutine frames : waiting allocates nothing, and nothing runs until a write. A write takes the lock of the property_, assigns the value, unlinks all the awaiters it satisfies at once and releases the lock ; then it resumes them one after the other on the writing thread. Each awaiter receives a copy of the value written, so the coroutine sees the value that satisfied it even if another write follows.
+  /// @remarks set_async() hands the write to an executor, any function object called with a job to run later, and returns an awaitable that resumes the coroutine after the write. The value, the lock and the awaiters make the property_ safe to read, write and await from several threads ; get() returns a copy.
+  /// @par Examples
+  /// @code
+  /// class connection {
+  /// public:
+  ///   enum class states {closed, connecting, open};
+  ///   property_<states, awaitable_> state;
+  /// };
+  ///
+  /// task send(connection& c, std::string message) {
+  ///   co_await c.state.until([](auto state) {return state == connection::states::open;});
+  ///   // ... send message.
+  /// }
+  /// @endcode
+  template <class type_t>
+  class property_<type_t, awaitable_> : public awaitable_ {
+    struct awaiter_base_ {
+      property_* property = nullptr;
+      awaiter_base_* next = nullptr;
+      bool (*accepts)(const awaiter_base_*, const type_t&) = nullptr;
+      std::coroutine_handle<> handle;
+      std::optional<type_t> result;
+      bool parked = false;
+
+      explicit awaiter_base_(property_& property) noexcept : property(&property) {}
+      awaiter_base_(const awaiter_base_&) = delete;
+      awaiter_base_& operator=(const awaiter_base_&) = delete;
+      // A coroutine destroyed while it waits leaves the list of the property_.
+      ~awaiter_base_() {
+        if (!handle) return;
+        std::lock_guard<std::mutex> lock(property->guard);
+        if (parked) property->unlink(this);
+      }
+
+      bool await_ready() const noexcept {return false;}
+      type_t await_resume() {return std::move(*result);}
+    };
+
+  public:
+    /// @brief The awaitable returned by changed() : it resumes the coroutine on the next write and gives the value written.
+    class changed_awaiter_ : public awaiter_base_ {
+    public:
+      /// @cond
+      explicit changed_awaiter_(property_& property) noexcept : awaiter_base_(property) {}
+      bool await_suspend(std::coroutine_handle<> handle) {
+        std::lock_guard<std::mutex> lock(this->property->guard);
+        this->handle = handle;
+        this->property->park(this);
+        return true;
+      }
+      /// @endcond
+    };
+
+    /// @brief The awaitable returned by until() : it resumes the coroutine at once if the value matches the predicate, otherwise on the first write of a value that matches it, and gives that value.
+    template <class predicate_t>
+    class until_awaiter_ : public awaiter_base_ {
+    public:
+      /// @cond
+      until_awaiter_(property_& property, predicate_t predicate) : awaiter_base_(property), predicate(std::move(predicate)) {
+        this->accepts = [](const awaiter_base_* awaiter, const type_t& value) -> bool {return static_cast<const until_awaiter_*>(awaiter)->predicate(value);};
+      }
+      bool await_suspend(std::coroutine_handle<> handle) {
+        std::lock_guard<std::mutex> lock(this->property->guard);
+        if (predicate(this->property->value)) {
+          this->result.emplace(this->property->value);
+          return false;
+        }
+        this->handle = handle;
+        this->property->park(this);
+        return true;
+      }
+      /// @endcond
+
+    private:
+      predicate_t predicate;
+    };
+
+    /// @brief The awaitable returned by set_async() : it resumes the coroutine once the executor has run the write.
+    template <class executor_t>
+    class set_awaiter_ {
+    public:
+      /// @cond
+      set_awaiter_(property_& property, type_t value, executor_t& executor) : property(property), value(std::move(value)), executor(executor) {}
+      bool await_ready() const noexcept {return false;}
+      void await_suspend(std::coroutine_handle<> handle) {
+        executor([this, handle] {
+          property.set(std::move(value));
+          handle.resume();
+        });
+      }
+      void await_resume() const noexcept {}
+      /// @endcond
+
+    private:
+      property_& property;
+      type_t value;
+      executor_t& executor;
+    };
+
+    /// @brief This method is an accessor method that retrieves a copy of the value of the property_.
+    type_t get() const {
+      std::lock_guard<std::mutex> lock(guard);
+      return value;
+    }
+
+    /// @brief This operator is an accessor operator that retrieves a copy of the value of the property_.
+    type_t operator()() const {return get();}
+
+    /// @brief This method is an accessor method that assigns the value of the property_ and resumes the coroutines waiting for it.
+    void set(const type_t& value) {modify([&](type_t& current) {current = value;});}
+    /// @brief This method is an accessor method that moves the value into the property_ and resumes the coroutines waiting for it.
+    void set(type_t&& value) {modify([&](type_t& current) {current = std::move(value);});}
+
+    /// @brief This method is an accessor method that lets function modify the value of the property_ under its lock, then resumes the coroutines waiting for it.
+    /// @remarks If a predicate given to until() throws, the coroutines already satisfied by the value are resumed, the others keep waiting, and the exception is rethrown. If a resumed coroutine throws, the other ones are still resumed, then the first exception is rethrown.
+    template <class function_t>
+    void modify(function_t&& function) {
+      awaiter_base_* ready = nullptr;
+      auto failure = std::exception_ptr {};
+      {
+        std::lock_guard<std::mutex> lock(guard);
+        function(value);
+        try {
+          take_ready(ready);
+        } catch (...) {
+          failure = std::current_exception();
+        }
+      }
+      while (ready) {
+        auto next = ready->next;
+        try {
+          ready->handle.resume();
+        } catch (...) {
+          if (!failure) failure = std::current_exception();
+        }
+        ready = next;
+      }
+      if (failure) std::rethrow_exception(failure);
+    }
+
+    /// @brief Gets an awaitable that resumes the coroutine on the next write of the property_.
+    changed_awaiter_ changed() noexcept {return changed_awaiter_(*this);}
+
+    /// @brief Gets an awaitable that resumes the coroutine when the value of the property_ matches predicate.
+    template <class predicate_t>
+    until_awaiter_<std::decay_t<predicate_t>> until(predicate_t&& predicate) {return until_awaiter_<std::decay_t<predicate_t>>(*this, std::forward<predicate_t>(predicate));}
+
+    /// @brief Gets an awaitable that gives executor the job of writing value, then resumes the coroutine. executor is called with a function object without argument.
+    template <class executor_t>
+    set_awaiter_<executor_t> set_async(type_t value, executor_t& executor) {return set_awaiter_<executor_t>(*this, std::move(value), executor);}
+
+    /// @brief Gets the number of coroutines waiting for the property_.
+    std::size_t waiters() const {
+      std::lock_guard<std::mutex> lock(guard);
+      auto count = std::size_t {0};
+      for (auto awaiter = first; awaiter; awaiter = awaiter->next)
+        ++count;
+      return count;
+    }
+
+    /// @cond
+    property_() : value() {}
+    property_(const type_t& value) : value(value) {}
+    property_(type_t&& value) : value(std::move(value)) {}
+    property_(const property_& property) : value(property.get()) {}
+
+    operator type_t() const {return get();}
+    property_& operator=(const property_& other) {set(other.get()); return *this;}
+    bool operator==(const type_t& value) const {return get() == value;}
+    bool operator!=(const type_t& value) const {return get() != value;}
+
+    property_& operator=(const type_t& value) {set(value); return *this;}
+    property_& operator=(type_t&& value) {set(std::move(value)); return *this;}
+    void operator+=(const type_t& value) {modify(detail::compound_<detail::add_, type_t> {value});}
+    void operator-=(const type_t& value) {modify(detail::compound_<detail::subtract_, type_t> {value});}
+    void operator*=(const type_t& value) {modify(detail::compound_<detail::multiply_, type_t> {value});}
+    void operator /=(const type_t& value) {modify(detail::compound_<detail::divide_, type_t> {value});}
+    void operator %=(const type_t& value) {modify(detail::compound_<detail::modulus_, type_t> {value});}
+    void operator &=(const type_t& value) {modify(detail::compound_<detail::bit_and_, type_t> {value});}
+    void operator |=(const type_t& value) {modify(detail::compound_<detail::bit_or_, type_t> {value});}
+    void operator ^=(const type_t& value) {modify(detail::compound_<detail::bit_xor_, type_t> {value});}
+    void operator<<=(const type_t& value) {modify(detail::compound_<detail::left_shift_, type_t> {value});}
+    void operator>>=(const type_t& value) {modify(detail::compound_<detail::right_shift_, type_t> {value});}
+
+    friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
+    /// @endcond
+
+  private:
+    // The list and the parked flags are guarded by the lock.
+    void park(awaiter_base_* awaiter) noexcept {
+      awaiter->parked = true;
+      awaiter->next = first;
+      first = awaiter;
+    }
+
+    void unlink(awaiter_base_* awaiter) noexcept {
+      for (auto link = &first; *link; link = &(*link)->next)
+        if (*link == awaiter) {
+          *link = awaiter->next;
+          awaiter->parked = false;
+          return;
+        }
+    }
+
+    // Unlinks the awaiters satisfied by the value into ready and gives them a copy of it, in the order they were parked. If a predicate or the copy throws, ready keeps the awaiters taken before.
+    void take_ready(awaiter_base_*& ready) {
+      for (auto link = &first; *link;) {
+        auto awaiter = *link;
+        if (awaiter->accepts && !awaiter->accepts(awaiter, value)) {
+          link = &awaiter->next;
+          continue;
+        }
+        awaiter->result.emplace(value);
+        awaiter->parked = false;
+        *link = awaiter->next;
+        awaiter->next = ready;
+        ready = awaiter;
+      }
+    }
+
+    type_t value;
+    mutable std::mutex guard;
+    awaiter_base_* first = nullptr;
+  };
+}
+
+#pragma pop_macro("property_")
+
+/// @brief #awaitable_ represent a property_ read write attribute for a property_ whose changes can be awaited by coroutines.
+/// @ingroup keywords
+#define awaitable_ \
+  xtd::awaitable_
+#endif
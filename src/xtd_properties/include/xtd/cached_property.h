@@ -0,0 +1,157 @@
+/// @file
+/// @brief Contains cached_ attribute and property_<type_t, cached_> class.
+#pragma once
+
+#include "observable_property.h"
+#include <deque>
+#include <optional>
+#include <vector>
+
+// The property_ keyword is suspended while this header specializes the property_ class.
+#pragma push_macro("property_")
+#undef property_
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief cached_ struct represent a property_ read only attribute whose value is computed on demand and kept until one of its sources changes.
+  struct cached_ : public readonly_ {};
+
+  /// @brief A cached_ property_ is a read only property_ that computes its value with a function the first time it is read and returns the stored result until one of its sources is written.
+  /// @remarks The sources are observable_ or cached_ properties given to the constructor or to depends_on() ; the cached_ property_ subscribes to them and a write to any of them marks it dirty. A read of a clean cached_ property_ is a flag test and a reference return. invalidate() marks it dirty by hand, for example when the value depends on something that is not a property_.
+  /// @remarks A subscriber can subscribe and unsubscribe while it is called, as with an observable_ property_.
+  /// @remarks A cached_ property_ is itself a source : the cached_ properties that depend on it are invalidated with it. The sources must outlive the cached_ property_, so declare them before it in the owner class. A cached_ property_ is not thread safe and cannot be copied.
+  /// @par Examples
+  /// @code
+  /// class person {
+  /// public:
+  ///   property_<std::string, observable_> first_name;
+  ///   property_<std::string, observable_> last_name;
+  ///   property_<std::string, cached_> full_name {[&] {return first_name() + " " + last_name();}, first_name, last_name};
+  /// };
+  /// @endcode
+  template <class type_t>
+  class property_<type_t, cached_> : public cached_ {
+    using compute_type = detail::accessor_<type_t()>;
+    using unsubscribe_type = detail::accessor_<void()>;
+    using callback_type = detail::accessor_<void()>;
+
+  public:
+    /// @brief Initializes a new cached_ property_ computed by function and invalidated by sources.
+    template <class function_t, class... sources_t, class = std::enable_if_t<std::is_invocable_r<type_t, function_t&>::value>>
+    explicit property_(function_t&& function, sources_t&... sources) : compute(std::forward<function_t>(function)) {depends_on(sources...);}
+
+    /// @cond
+    property_(const property_&) = delete;
+    property_& operator=(const property_&) = delete;
+    ~property_() {
+      for (auto& unsubscribe : unsubscribes)
+        unsubscribe();
+    }
+    /// @endcond
+
+    /// @brief This method is an accessor method that retrieves the value of the property_, computing it if it is dirty.
+    const type_t& get() const {return getter();}
+
+    /// @brief This operator is an accessor operator that retrieves the value of the property_, computing it if it is dirty.
+    const type_t& operator()() const {return getter();}
+
+    /// @brief Makes sources invalidate the property_ when they are written.
+    /// @return This property_.
+    template <class... sources_t>
+    property_& depends_on(sources_t&... sources) {
+      (add_source(sources), ...);
+      return *this;
+    }
+
+    /// @brief Marks the property_ dirty, so that the next read computes it again, and invalidates the cached_ properties that depend on it.
+    /// @remarks The subscribers are notified even if the property_ is already dirty : a dependent may have been computed again without reading it, and must be invalidated too.
+    void invalidate() {
+      dirty = true;
+      // The slots do not move while they are called, and the subscribers added by a callback have an id above last.
+      notify_guard guard(*this);
+      auto last = last_id;
+      for (auto index = std::size_t {0}; index < subscribers.size(); ++index)
+        if (subscribers[index].id && subscribers[index].id <= last) subscribers[index].callback();
+    }
+
+    /// @brief Gets whether the stored value is up to date.
+    bool is_valid() const noexcept {return !dirty;}
+
+    /// @brief Subscribes function, called without argument each time the property_ is invalidated.
+    /// @return The subscription to give to unsubscribe().
+    template <class function_t>
+    subscription_ subscribe(function_t&& function) {
+      subscribers.push_back({++last_id, callback_type([function = std::forward<function_t>(function)]() mutable {function();})});
+      return {last_id};
+    }
+
+    /// @brief Unsubscribes the given subscription.
+    /// @return true if the subscription was found ; otherwise false.
+    bool unsubscribe(subscription_ subscription) {
+      for (auto& subscriber : subscribers)
+        if (subscription && subscriber.id == subscription.id) {
+          subscriber.id = 0;
+          if (!notifying) release_unsubscribed();
+          return true;
+        }
+      return false;
+    }
+
+    /// @cond
+    operator const type_t&() const {return getter();}
+    bool operator==(const type_t& value) const {return getter() == value;}
+    bool operator!=(const type_t& value) const {return getter() != value;}
+
+    friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
+    /// @endcond
+
+  private:
+    struct subscriber_type {
+      std::size_t id = 0;
+      callback_type callback;
+    };
+
+    // Destroys the callbacks unsubscribed during the notification when the outermost one ends, even if a subscriber throws.
+    struct notify_guard {
+      explicit notify_guard(property_& property) noexcept : property(property) {++property.notifying;}
+      ~notify_guard() {if (--property.notifying == 0) property.release_unsubscribed();}
+      property_& property;
+    };
+
+    void release_unsubscribed() {
+      while (!subscribers.empty() && !subscribers.back().id) subscribers.pop_back();
+      for (auto& subscriber : subscribers)
+        if (!subscriber.id) subscriber.callback = callback_type();
+    }
+
+    const type_t& getter() const {
+      if (!dirty) return *value;
+      if (value) *value = compute();
+      else value.emplace(compute());
+      dirty = false;
+      return *value;
+    }
+
+    template <class source_t>
+    void add_source(source_t& source) {
+      auto subscription = source.subscribe([this](const auto&...) {invalidate();});
+      unsubscribes.emplace_back([&source, subscription] {source.unsubscribe(subscription);});
+      invalidate();
+    }
+
+    compute_type compute;
+    mutable std::optional<type_t> value;
+    mutable bool dirty = true;
+    std::vector<unsubscribe_type> unsubscribes;
+    std::deque<subscriber_type> subscribers;
+    std::size_t last_id = 0;
+    std::size_t notifying = 0;
+  };
+}
+
+#pragma pop_macro("property_")
+
+/// @brief #cached_ represent a property_ read only attribute whose value is computed on demand and kept until one of its sources changes.
+/// @ingroup keywords
+#define cached_ \
+  xtd::cached_
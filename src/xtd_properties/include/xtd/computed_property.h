@@ -0,0 +1,84 @@
+/// @file
+/// @brief Contains computed_ attribute, property_<type_t, computed_> class and #compute_ keyword.
+#pragma once
+
+#include "properties.h"
+
+// The property_ keyword is suspended while this header specializes the property_ class.
+#pragma push_macro("property_")
+#undef property_
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief computed_ struct represent a property_ read only attribute for a property_ whose value is computed by its getter and returned by value.
+  struct computed_ : public readonly_ {};
+
+  /// @brief A computed_ property_ is a read only property_ whose #compute_ accessor returns a new value on each read, such as a sum or a concatenation of other fields.
+  /// @remarks A #get_ accessor returns a reference, so it must return a field : returning a temporary would dangle. A #compute_ accessor returns by value ; the value is constructed directly in the caller's object, without copy nor move, and the accessor is stored inline, without heap allocation.
+  /// @remarks The getter is called on each read ; use a cached_ property_ when the computation is expensive.
+  /// @par Examples
+  /// @code
+  /// class person {
+  /// public:
+  ///   property_<std::string, computed_> full_name {
+  ///     compute_ {return first_name + " " + last_name;}
+  ///   };
+  ///
+  /// private:
+  ///   std::string first_name = "John";
+  ///   std::string last_name = "Doe";
+  /// };
+  ///
+  /// person p;
+  /// std::string name = p.full_name; // Computed into name.
+  /// @endcode
+  template <class type_t>
+  class property_<type_t, computed_> : public computed_ {
+    using getter_type = detail::accessor_<type_t()>;
+
+  public:
+    /// @brief This method is an accessor method that computes the value of the property_.
+    type_t get() const {return getter();}
+
+    /// @brief This operator is an accessor operator that computes the value of the property_.
+    type_t operator()() const {return getter();}
+
+    /// @brief Replaces the #compute_ accessor of the property_ ; the closure is stored inline, without allocation, when it fits the accessor storage ; inline_accessor_ checks that at compile time. If storing the closure throws, the property_ keeps its accessor.
+    template <class function_t>
+    void rebind_getter(function_t&& getter) {this->getter.rebind(std::forward<function_t>(getter));}
+
+    /// @cond
+    explicit property_(const getter_type& getter) : getter(getter) {}
+    property_(const property_&) = delete;
+    property_& operator=(const property_&) {return *this;}
+
+    operator type_t() const {return getter();}
+    bool operator==(const type_t& value) const {return getter() == value;}
+    bool operator!=(const type_t& value) const {return getter() != value;}
+
+    friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
+    /// @endcond
+
+  private:
+    getter_type getter;
+  };
+}
+
+#pragma pop_macro("property_")
+
+/// @brief #computed_ represent a property_ read only attribute for a property_ whose value is computed by its getter and returned by value.
+/// @ingroup keywords
+#define computed_ \
+  xtd::computed_
+
+/// @brief The #compute_ keyword is used to define the accessor method of a computed_ property_ : it returns a new value instead of a reference.
+/// @par Library
+/// xtd.properties
+/// @ingroup keywords
+#if defined(XTD_PROPERTIES_INSTRUMENTATION)
+#define compute_ \
+  XTD_PROPERTIES_SITE_("compute") ->* [&]()
+#else
+#define compute_ \
+  [&]()
+#endif
@@ -0,0 +1,166 @@
+/// @file
+/// @brief Contains cow_ attribute and property_<type_t, cow_> class.
+#pragma once
+
+#include "properties.h"
+#include <atomic>
+
+// The property_ keyword is suspended while this header specializes the property_ class.
+#pragma push_macro("property_")
+#undef property_
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief cow_ struct represent a property_ read write attribute for an auto-property whose value is shared between copies until one of them is written.
+  struct cow_ : public readwrite_ {};
+
+  /// @cond
+  namespace detail {
+    template <class type_t>
+    struct cow_empty_;
+
+    template <class type_t>
+    struct cow_node_ {
+      template <class... args_t>
+      explicit cow_node_(args_t&&... args) : value(std::forward<args_t>(args)...) {}
+
+      static void add_reference(cow_node_* node) noexcept {
+        if (node != cow_empty_<type_t>::address()) node->references.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      static void release(cow_node_* node) noexcept {
+        if (node == cow_empty_<type_t>::address()) return;
+        if (node->references.fetch_sub(1, std::memory_order_acq_rel) == 1) delete node;
+      }
+
+      std::atomic<std::size_t> references {1};
+      type_t value;
+    };
+
+    // The node shared by the default constructed properties, never counted nor deleted. Comparing with its address needs no type_t() ; only the default constructor builds the node, so that type_t needs a default constructor only there.
+    template <class type_t>
+    struct cow_empty_ {
+      static cow_node_<type_t>* address() noexcept {return reinterpret_cast<cow_node_<type_t>*>(storage);}
+      static cow_node_<type_t>* node() {
+        static auto node = new (storage) cow_node_<type_t>();
+        return node;
+      }
+
+      alignas(cow_node_<type_t>) static inline unsigned char storage[sizeof(cow_node_<type_t>)] {};
+    };
+  }
+  /// @endcond
+
+  /// @brief A cow_ property_ is a read write auto-property whose value is shared, copy on write, between the copies of the property_.
+  /// @remarks Copying the property_, and so the owner class, only increments a reference count : it does not copy the value. The first write to a copy through set(), emplace(), modify() or a compound operator clones the value if it is still shared ; writes to a value that is not shared change it in place. get() returns a reference to the shared value, which stays valid until the next write to this property_.
+  /// @remarks The reference count is atomic : copies of the same property_ can be read and written from different threads, like std::shared_ptr. A single property_ is not thread safe. Use it for strings, vectors and maps held by owners that are copied far more often than written.
+  /// @remarks A default constructed property_ does not allocate : it shares one static default value per type_t until its first write.
+  /// @par Examples
+  /// @code
+  /// class document {
+  /// public:
+  ///   property_<std::string, cow_> text;
+  /// };
+  ///
+  /// document d1;
+  /// d1.text = std::string(1'000'000, 'x');
+  /// document d2 = d1; // d1.text and d2.text share the same string.
+  /// d2.text += "y";   // d2.text clones the string, then appends to its own copy.
+  /// @endcode
+  template <class type_t>
+  class property_<type_t, cow_> : public cow_ {
+    using node_type = detail::cow_node_<type_t>;
+
+  public:
+    /// @brief This method is an accessor method that retrieves the value of the property_.
+    const type_t& get() const noexcept {return node->value;}
+
+    /// @brief This operator is an accessor operator that retrieves the value of the property_.
+    const type_t& operator()() const noexcept {return node->value;}
+
+    /// @brief This method is an accessor method that assigns the value of the property_ ; the value is assigned in place if it is not shared.
+    const type_t& set(const type_t& value) {
+      if (is_shared()) replace(new node_type(value));
+      else node->value = value;
+      return node->value;
+    }
+    /// @brief This method is an accessor method that moves the value into the property_.
+    const type_t& set(type_t&& value) {
+      if (is_shared()) replace(new node_type(std::move(value)));
+      else node->value = std::move(value);
+      return node->value;
+    }
+
+    /// @brief This method is an accessor method that constructs the value of the property_ from args.
+    template <class... args_t>
+    const type_t& emplace(args_t&&... args) {
+      if (is_shared()) replace(new node_type(std::forward<args_t>(args)...));
+      else node->value = type_t(std::forward<args_t>(args)...);
+      return node->value;
+    }
+
+    /// @brief This method is an accessor method that lets function modify the value of the property_ in place, after cloning it if it is shared.
+    template <class function_t>
+    const type_t& modify(function_t&& function) {
+      if (is_shared()) replace(new node_type(node->value));
+      function(node->value);
+      return node->value;
+    }
+
+    /// @brief This operator is an accessor operator that assigns the value of the property_.
+    const type_t& operator()(const type_t& value) {return set(value);}
+    /// @brief This operator is an accessor operator that moves the value into the property_.
+    const type_t& operator()(type_t&& value) {return set(std::move(value));}
+
+    /// @brief Gets whether the value is shared with another copy of the property_, or is the default value shared by the default constructed properties.
+    bool is_shared() const noexcept {return node == detail::cow_empty_<type_t>::address() || node->references.load(std::memory_order_acquire) != 1;}
+
+    /// @cond
+    property_() : node(detail::cow_empty_<type_t>::node()) {}
+    property_(const type_t& value) : node(new node_type(value)) {}
+    property_(type_t&& value) : node(new node_type(std::move(value))) {}
+    property_(const property_& property) noexcept : node(property.node) {node_type::add_reference(node);}
+    ~property_() {node_type::release(node);}
+
+    operator const type_t&() const noexcept {return node->value;}
+    property_& operator=(const property_& other) noexcept {
+      node_type::add_reference(other.node);
+      replace(other.node);
+      return *this;
+    }
+    bool operator==(const type_t& value) const {return node->value == value;}
+    bool operator!=(const type_t& value) const {return node->value != value;}
+
+    property_& operator=(const type_t& value) {set(value); return *this;}
+    property_& operator=(type_t&& value) {set(std::move(value)); return *this;}
+    void operator+=(const type_t& value) {modify(detail::compound_<detail::add_, type_t> {value});}
+    void operator-=(const type_t& value) {modify(detail::compound_<detail::subtract_, type_t> {value});}
+    void operator*=(const type_t& value) {modify(detail::compound_<detail::multiply_, type_t> {value});}
+    void operator /=(const type_t& value) {modify(detail::compound_<detail::divide_, type_t> {value});}
+    void operator %=(const type_t& value) {modify(detail::compound_<detail::modulus_, type_t> {value});}
+    void operator &=(const type_t& value) {modify(detail::compound_<detail::bit_and_, type_t> {value});}
+    void operator |=(const type_t& value) {modify(detail::compound_<detail::bit_or_, type_t> {value});}
+    void operator ^=(const type_t& value) {modify(detail::compound_<detail::bit_xor_, type_t> {value});}
+    void operator<<=(const type_t& value) {modify(detail::compound_<detail::left_shift_, type_t> {value});}
+    void operator>>=(const type_t& value) {modify(detail::compound_<detail::right_shift_, type_t> {value});}
+
+    friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
+    /// @endcond
+
+  private:
+    void replace(node_type* new_node) noexcept {
+      auto old_node = node;
+      node = new_node;
+      node_type::release(old_node);
+    }
+
+    node_type* node;
+  };
+}
+
+#pragma pop_macro("property_")
+
+/// @brief #cow_ represent a property_ read write attribute for an auto-property whose value is shared between copies until one of them is written.
+/// @ingroup keywords
+#define cow_ \
+  xtd::cow_
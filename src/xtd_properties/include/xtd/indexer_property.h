@@ -0,0 +1,199 @@
+/// @file
+/// @brief Contains indexer_ attribute, property_<type_t, indexer_> class, #get_at_ and #set_at_ keywords.
+#pragma once
+
+#include "properties.h"
+#include <algorithm>
+#if __has_include(<span>)
+#include <span>
+#endif
+
+// The property_ keyword is suspended while this header specializes the property_ class.
+#pragma push_macro("property_")
+#undef property_
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief indexer_ struct represent a property_ read write attribute for a property_ whose elements are accessed by index.
+  struct indexer_ : public readwrite_ {};
+
+  /// @brief An indexer_ property_ gives access to the elements of a sequence owned by its owner class through per element accessors, like a C# indexer : obj.items[i] = x.
+  /// @remarks It is built from a #get_at_ accessor, a #set_at_ accessor, an accessor returning the number of elements and, optionally, an accessor returning a pointer to contiguous storage of the elements.
+  /// @remarks read(), write() and write_raw() copy ranges of elements ; a range running past size() is clamped and they return the number of elements copied. write() calls #set_at_ for each element. When the data accessor is given, read() and write_raw() copy straight from and to the storage with std::copy, which the compiler can vectorize : write_raw() then bypasses the checks of #set_at_. Without the data accessor they call the accessors for each element.
+  /// @par Examples
+  /// @code
+  /// class histogram {
+  /// public:
+  ///   property_<int, indexer_> bins {
+  ///     get_at_ {return bins_[index];},
+  ///     set_at_ {bins_[index] = value < 0 ? 0 : value;},
+  ///     [&] {return bins_.size();}
+  ///   };
+  ///
+  /// private:
+  ///   std::vector<int> bins_ = std::vector<int>(16);
+  /// };
+  ///
+  /// histogram h;
+  /// h.bins[3] = 42;
+  /// h.bins[3] += 1;
+  /// int bins[16];
+  /// h.bins.read(0, bins, 16);
+  /// @endcode
+  template <class type_t>
+  class property_<type_t, indexer_> : public indexer_ {
+    using getter_type = detail::accessor_<const type_t&(std::size_t)>;
+    using setter_type = detail::accessor_<void(std::size_t, const type_t&), void(std::size_t, type_t&&)>;
+    using size_type = detail::accessor_<std::size_t()>;
+    using data_type = detail::accessor_<type_t*()>;
+
+  public:
+    /// @brief The element of an indexer_ property_ returned by operator[] : reading it calls #get_at_ and writing it calls #set_at_.
+    class element_ {
+    public:
+      /// @brief Retrieves the value of the element.
+      const type_t& get() const {return property->getter(index);}
+      /// @brief Assigns the value of the element.
+      void set(const type_t& value) {property->setter(index, value);}
+      /// @brief Moves value into the element.
+      void set(type_t&& value) {property->setter(index, std::move(value));}
+
+      /// @cond
+      operator const type_t&() const {return get();}
+      element_& operator=(const element_& other) {set(other.get()); return *this;}
+      element_& operator=(const type_t& value) {set(value); return *this;}
+      element_& operator=(type_t&& value) {set(std::move(value)); return *this;}
+      bool operator==(const type_t& value) const {return get() == value;}
+      bool operator!=(const type_t& value) const {return get() != value;}
+
+      void operator+=(const type_t& value) {compound(detail::compound_<detail::add_, type_t> {value});}
+      void operator-=(const type_t& value) {compound(detail::compound_<detail::subtract_, type_t> {value});}
+      void operator*=(const type_t& value) {compound(detail::compound_<detail::multiply_, type_t> {value});}
+      void operator /=(const type_t& value) {compound(detail::compound_<detail::divide_, type_t> {value});}
+      void operator %=(const type_t& value) {compound(detail::compound_<detail::modulus_, type_t> {value});}
+      void operator &=(const type_t& value) {compound(detail::compound_<detail::bit_and_, type_t> {value});}
+      void operator |=(const type_t& value) {compound(detail::compound_<detail::bit_or_, type_t> {value});}
+      void operator ^=(const type_t& value) {compound(detail::compound_<detail::bit_xor_, type_t> {value});}
+      void operator<<=(const type_t& value) {compound(detail::compound_<detail::left_shift_, type_t> {value});}
+      void operator>>=(const type_t& value) {compound(detail::compound_<detail::right_shift_, type_t> {value});}
+
+      friend std::ostream& operator<<(std::ostream& os, const element_& e) {return os << e.get();}
+      /// @endcond
+
+    private:
+      friend class property_;
+      element_(property_* property, std::size_t index) noexcept : property(property), index(index) {}
+
+      template <class function_t>
+      void compound(function_t&& function) {
+        auto value = get();
+        function(value);
+        set(std::move(value));
+      }
+
+      property_* property;
+      std::size_t index;
+    };
+
+    /// @brief Initializes a new indexer_ property_ from its element accessors and the accessor returning the number of elements.
+    template <class getter_t, class setter_t, class size_t_>
+    property_(getter_t&& getter, setter_t&& setter, size_t_&& size) : getter(std::forward<getter_t>(getter)), setter(std::forward<setter_t>(setter)), counter(std::forward<size_t_>(size)) {}
+
+    /// @brief Initializes a new indexer_ property_ from its element accessors, the accessor returning the number of elements and the accessor returning a pointer to the contiguous storage used by read() and write().
+    template <class getter_t, class setter_t, class size_t_, class data_t>
+    property_(getter_t&& getter, setter_t&& setter, size_t_&& size, data_t&& data) : getter(std::forward<getter_t>(getter)), setter(std::forward<setter_t>(setter)), counter(std::forward<size_t_>(size)), data(std::forward<data_t>(data)) {}
+
+    /// @cond
+    property_(const property_&) = delete;
+    property_& operator=(const property_&) = delete;
+    /// @endcond
+
+    /// @brief Gets the number of elements.
+    std::size_t size() const {return counter();}
+
+    /// @brief Retrieves the element at index.
+    const type_t& get(std::size_t index) const {return getter(index);}
+    /// @brief Assigns value to the element at index.
+    void set(std::size_t index, const type_t& value) {setter(index, value);}
+    /// @brief Moves value into the element at index.
+    void set(std::size_t index, type_t&& value) {setter(index, std::move(value));}
+
+    /// @brief Gets the element at index.
+    element_ operator[](std::size_t index) noexcept {return element_(this, index);}
+    /// @brief Retrieves the element at index.
+    const type_t& operator[](std::size_t index) const {return getter(index);}
+
+    /// @brief Copies count elements, starting at the element first, to target.
+    /// @return The number of elements copied : count clamped to the elements from first to size().
+    std::size_t read(std::size_t first, type_t* target, std::size_t count) const {
+      count = clamp(first, count);
+      if (data) {
+        auto source = data() + first;
+        std::copy(source, source + count, target);
+      } else
+        for (auto index = std::size_t {0}; index < count; ++index)
+          target[index] = getter(first + index);
+      return count;
+    }
+
+    /// @brief Copies count elements from source to the elements starting at first, through #set_at_.
+    /// @return The number of elements copied : count clamped to the elements from first to size().
+    std::size_t write(std::size_t first, const type_t* source, std::size_t count) {
+      count = clamp(first, count);
+      for (auto index = std::size_t {0}; index < count; ++index)
+        setter(first + index, source[index]);
+      return count;
+    }
+
+    /// @brief Copies count elements from source straight to the storage returned by the data accessor, starting at first, without calling #set_at_.
+    /// @return The number of elements copied : count clamped to the elements from first to size().
+    /// @remarks Without the data accessor, it calls #set_at_ for each element like write().
+    std::size_t write_raw(std::size_t first, const type_t* source, std::size_t count) {
+      if (!data) return write(first, source, count);
+      count = clamp(first, count);
+      std::copy(source, source + count, data() + first);
+      return count;
+    }
+
+#if defined(__cpp_lib_span)
+    /// @brief Copies target.size() elements, starting at the element first, to target.
+    std::size_t read(std::size_t first, std::span<type_t> target) const {return read(first, target.data(), target.size());}
+    /// @brief Copies the elements of source to the elements starting at first, through #set_at_.
+    std::size_t write(std::size_t first, std::span<const type_t> source) {return write(first, source.data(), source.size());}
+    /// @brief Copies the elements of source straight to the storage returned by the data accessor, starting at first, without calling #set_at_.
+    std::size_t write_raw(std::size_t first, std::span<const type_t> source) {return write_raw(first, source.data(), source.size());}
+#endif
+
+  private:
+    std::size_t clamp(std::size_t first, std::size_t count) const {
+      auto size = counter();
+      return first < size ? std::min(count, size - first) : 0;
+    }
+
+    getter_type getter;
+    setter_type setter;
+    size_type counter;
+    data_type data;
+  };
+}
+
+#pragma pop_macro("property_")
+
+/// @brief #indexer_ represent a property_ read write attribute for a property_ whose elements are accessed by index.
+/// @ingroup keywords
+#define indexer_ \
+  xtd::indexer_
+
+/// @brief The #get_at_ keyword is used to define the accessor method that retrieves the element at index of an indexer_ property_.
+/// @par Library
+/// xtd.properties
+/// @ingroup keywords
+#define get_at_ \
+  [&](std::size_t index) -> const auto&
+
+/// @brief The #set_at_ keyword is used to define the accessor method that assigns value to the element at index of an indexer_ property_.
+/// @par Library
+/// xtd.properties
+/// @ingroup keywords
+#define set_at_ \
+  [&](std::size_t index, auto&& value)
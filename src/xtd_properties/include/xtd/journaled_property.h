@@ -0,0 +1,288 @@
+/// @file
+/// @brief Contains journaled_ attribute, property_<type_t, journaled_> and property_journal_ classes.
+#pragma once
+
+#include "properties.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// The property_ keyword is suspended while this header specializes the property_ class.
+#pragma push_macro("property_")
+#undef property_
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief journaled_ struct represent a property_ read write attribute for an auto-property whose writes are recorded in a property_journal_.
+  struct journaled_ : public readwrite_ {};
+
+  /// @cond
+  namespace detail {
+    template <class type_t>
+    struct journal_values_ {
+      type_t old_value;
+      type_t new_value;
+    };
+  }
+  /// @endcond
+
+  /// @brief A property_journal_ records the writes to journaled_ properties, with the value before and after each write, so that they can be undone and redone.
+  /// @remarks The journal keeps the last capacity() writes in a ring allocated once by the constructor : when it is full, recording a write drops the oldest one. The old and new values of a write are stored in the slot of the write when they fit in value_size bytes each, so recording a trivially copyable value of that size is two copies and no allocation ; larger values are allocated.
+  /// @remarks undo() restores the old values of the last writes, newest first, and redo() writes the new values again ; neither records anything. A write recorded after an undo() discards the writes that could be redone. The journal is not thread safe, and it must outlive the properties that record in it.
+  /// @par Examples
+  /// @code
+  /// class shape {
+  /// public:
+  ///   property_journal_ journal;
+  ///   property_<int, journaled_> x {journal};
+  ///   property_<int, journaled_> y {journal};
+  /// };
+  ///
+  /// shape s;
+  /// auto mark = s.journal.position();
+  /// s.x = 10;
+  /// s.y = 20;
+  /// s.journal.undo(s.journal.position() - mark); // x and y are 0 again.
+  /// s.journal.redo(2);                            // x is 10 and y is 20.
+  /// @endcode
+  class property_journal_ {
+  public:
+    /// @brief Initializes a new journal that keeps the last capacity writes, storing values up to value_size bytes without allocation.
+    explicit property_journal_(std::size_t capacity = 1024, std::size_t value_size = 2 * sizeof(void*)) : records(capacity), stride((2 * value_size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)), arena(new std::max_align_t[capacity * stride]) {}
+
+    /// @cond
+    property_journal_(const property_journal_&) = delete;
+    property_journal_& operator=(const property_journal_&) = delete;
+    ~property_journal_() {clear();}
+    /// @endcond
+
+    /// @brief Gets the maximum number of writes kept.
+    std::size_t capacity() const noexcept {return records.size();}
+    /// @brief Gets the number of writes that can be undone.
+    std::size_t size() const noexcept {return count;}
+    /// @brief Gets whether a write can be undone.
+    bool can_undo() const noexcept {return count != 0;}
+    /// @brief Gets whether an undone write can be redone.
+    bool can_redo() const noexcept {return redo_count != 0;}
+    /// @brief Gets the number of writes recorded and not undone since the journal was created ; the difference of two positions is the number of writes to undo or redo to go from one to the other.
+    std::size_t position() const noexcept {return current;}
+
+    /// @brief Restores the old values of the last count writes, newest first.
+    /// @return The number of writes undone.
+    std::size_t undo(std::size_t count = 1) {
+      auto undone = std::size_t {0};
+      for (; undone < count && this->count; ++undone) {
+        auto& record = records[(first + this->count - 1) % records.size()];
+        if (record.target) record.restore(record.target, record.old_value);
+        --this->count;
+        ++redo_count;
+        --current;
+      }
+      return undone;
+    }
+
+    /// @brief Writes again the new values of the last count writes undone, oldest first.
+    /// @return The number of writes redone.
+    std::size_t redo(std::size_t count = 1) {
+      auto redone = std::size_t {0};
+      for (; redone < count && redo_count; ++redone) {
+        auto& record = records[(first + this->count) % records.size()];
+        if (record.target) record.restore(record.target, record.new_value);
+        ++this->count;
+        --redo_count;
+        ++current;
+      }
+      return redone;
+    }
+
+    /// @brief Drops the oldest writes so that at most count writes can be undone ; the writes that can be redone are kept.
+    void truncate(std::size_t count) noexcept {
+      while (this->count > count) drop_oldest();
+    }
+
+    /// @brief Drops all the writes.
+    void clear() noexcept {
+      discard_redo();
+      truncate(0);
+    }
+
+  private:
+    template <class, class, class, class> friend class property_;
+
+    struct record_type {
+      void* target = nullptr;
+      std::size_t* recorded = nullptr;
+      void (*restore)(void*, const void*) = nullptr;
+      void (*destroy)(void*) = nullptr;
+      void* values = nullptr;
+      const void* old_value = nullptr;
+      const void* new_value = nullptr;
+    };
+
+    template <class type_t, class old_t, class new_t>
+    void record(void* target, std::size_t& recorded, void (*restore)(void*, const void*), old_t&& old_value, new_t&& new_value) {
+      using values_type = detail::journal_values_<type_t>;
+      if (records.empty()) return;
+      discard_redo();
+      if (count == records.size()) drop_oldest();
+      auto index = (first + count) % records.size();
+      auto slot = static_cast<void*>(arena.get() + index * stride);
+      values_type* values = nullptr;
+      void (*destroy)(void*) = nullptr;
+      if (alignof(values_type) <= alignof(std::max_align_t) && sizeof(values_type) <= stride * sizeof(std::max_align_t)) {
+        values = new (slot) values_type {std::forward<old_t>(old_value), std::forward<new_t>(new_value)};
+        if constexpr (!std::is_trivially_destructible<values_type>::value) destroy = [](void* values) {static_cast<values_type*>(values)->~values_type();};
+      } else {
+        values = new values_type {std::forward<old_t>(old_value), std::forward<new_t>(new_value)};
+        destroy = [](void* values) {delete static_cast<values_type*>(values);};
+      }
+      records[index] = {target, &recorded, restore, destroy, values, &values->old_value, &values->new_value};
+      ++recorded;
+      ++count;
+      ++current;
+    }
+
+    // The writes of a destroyed property_ stay in the journal but are skipped by undo() and redo(). recorded is the number of its writes still in the journal : the scan stops when all are found, and a property_ without any skips it.
+    void forget(const void* target, std::size_t& recorded) noexcept {
+      for (auto index = std::size_t {0}; recorded && index < records.size(); ++index)
+        if (records[index].target == target) {
+          records[index].target = nullptr;
+          --recorded;
+        }
+    }
+
+    void release(record_type& record) noexcept {
+      if (record.target) --*record.recorded;
+      if (record.destroy) record.destroy(record.values);
+      record = record_type {};
+    }
+
+    void drop_oldest() noexcept {
+      release(records[first]);
+      first = (first + 1) % records.size();
+      --count;
+    }
+
+    void discard_redo() noexcept {
+      for (; redo_count; --redo_count)
+        release(records[(first + count + redo_count - 1) % records.size()]);
+    }
+
+    std::vector<record_type> records;
+    std::size_t stride;
+    std::unique_ptr<std::max_align_t[]> arena;
+    std::size_t first = 0;
+    std::size_t count = 0;
+    std::size_t redo_count = 0;
+    std::size_t current = 0;
+  };
+
+  /// @brief A journaled_ property_ is a read write auto-property that records each write, with its old and new values, in a property_journal_ so that it can be undone.
+  /// @remarks set(), emplace(), modify(), operator= and the compound operators record one write each ; a property_ built without a journal records nothing. undo() and redo() of the journal restore the value directly, without recording.
+  /// @remarks A copy of the property_ records in the same journal. The destructor keeps the writes of the property_ in the journal, but they are not restored anymore ; it looks for them only if some are still in the journal.
+  /// @par Examples
+  /// @code
+  /// class document {
+  /// public:
+  ///   property_journal_ history {256};
+  ///   property_<std::string, journaled_> title {history, "Untitled"};
+  /// };
+  ///
+  /// document d;
+  /// d.title = "Report";
+  /// d.title += " 2024";
+  /// d.history.undo(); // title is "Report".
+  /// @endcode
+  template <class type_t>
+  class property_<type_t, journaled_> : public journaled_ {
+  public:
+    /// @brief This method is an accessor method that retrieves the value of the property_.
+    const type_t& get() const noexcept {return value;}
+
+    /// @brief This operator is an accessor operator that retrieves the value of the property_.
+    const type_t& operator()() const noexcept {return value;}
+
+    /// @brief This method is an accessor method that records and assigns the value of the property_.
+    const type_t& set(const type_t& value) {
+      if (owner_journal) owner_journal->template record<type_t>(this, recorded, &restore, this->value, value);
+      this->value = value;
+      return this->value;
+    }
+    /// @brief This method is an accessor method that records and moves the value into the property_.
+    const type_t& set(type_t&& value) {
+      if (owner_journal) owner_journal->template record<type_t>(this, recorded, &restore, this->value, value);
+      this->value = std::move(value);
+      return this->value;
+    }
+
+    /// @brief This method is an accessor method that records and assigns a value constructed from args.
+    template <class... args_t>
+    const type_t& emplace(args_t&&... args) {return set(type_t(std::forward<args_t>(args)...));}
+
+    /// @brief This method is an accessor method that lets function modify the value of the property_ in place, then records the write.
+    template <class function_t>
+    const type_t& modify(function_t&& function) {
+      if (!owner_journal) {
+        function(value);
+        return value;
+      }
+      auto old_value = value;
+      function(value);
+      owner_journal->template record<type_t>(this, recorded, &restore, std::move(old_value), value);
+      return value;
+    }
+
+    /// @brief This operator is an accessor operator that records and assigns the value of the property_.
+    const type_t& operator()(const type_t& value) {return set(value);}
+    /// @brief This operator is an accessor operator that records and moves the value into the property_.
+    const type_t& operator()(type_t&& value) {return set(std::move(value));}
+
+    /// @brief Gets the journal the writes are recorded in, nullptr if none.
+    property_journal_* journal() const noexcept {return owner_journal;}
+
+    /// @cond
+    property_() : value() {}
+    property_(const type_t& value) : value(value) {}
+    property_(type_t&& value) : value(std::move(value)) {}
+    property_(property_journal_& journal) : value(), owner_journal(&journal) {}
+    property_(property_journal_& journal, const type_t& value) : value(value), owner_journal(&journal) {}
+    property_(property_journal_& journal, type_t&& value) : value(std::move(value)), owner_journal(&journal) {}
+    property_(const property_& property) : value(property.value), owner_journal(property.owner_journal) {}
+    ~property_() {if (owner_journal) owner_journal->forget(this, recorded);}
+
+    operator const type_t&() const noexcept {return value;}
+    property_& operator=(const property_& other) {set(other.value); return *this;}
+    bool operator==(const type_t& value) const {return this->value == value;}
+    bool operator!=(const type_t& value) const {return this->value != value;}
+
+    property_& operator=(const type_t& value) {set(value); return *this;}
+    property_& operator=(type_t&& value) {set(std::move(value)); return *this;}
+    void operator+=(const type_t& value) {modify(detail::compound_<detail::add_, type_t> {value});}
+    void operator-=(const type_t& value) {modify(detail::compound_<detail::subtract_, type_t> {value});}
+    void operator*=(const type_t& value) {modify(detail::compound_<detail::multiply_, type_t> {value});}
+    void operator /=(const type_t& value) {modify(detail::compound_<detail::divide_, type_t> {value});}
+    void operator %=(const type_t& value) {modify(detail::compound_<detail::modulus_, type_t> {value});}
+    void operator &=(const type_t& value) {modify(detail::compound_<detail::bit_and_, type_t> {value});}
+    void operator |=(const type_t& value) {modify(detail::compound_<detail::bit_or_, type_t> {value});}
+    void operator ^=(const type_t& value) {modify(detail::compound_<detail::bit_xor_, type_t> {value});}
+    void operator<<=(const type_t& value) {modify(detail::compound_<detail::left_shift_, type_t> {value});}
+    void operator>>=(const type_t& value) {modify(detail::compound_<detail::right_shift_, type_t> {value});}
+
+    friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
+    /// @endcond
+
+  private:
+    static void restore(void* target, const void* value) {static_cast<property_*>(target)->value = *static_cast<const type_t*>(value);}
+
+    type_t value;
+    property_journal_* owner_journal = nullptr;
+    std::size_t recorded = 0;
+  };
+}
+
+#pragma pop_macro("property_")
+
+/// @brief #journaled_ represent a property_ read write attribute for an auto-property whose writes are recorded in a property_journal_.
+/// @ingroup keywords
+#define journaled_ \
+  xtd::journaled_
@@ -0,0 +1,98 @@
+/// @file
+/// @brief Contains literal_ attribute and property_<type_t, literal_> class.
+#pragma once
+
+#include "properties.h"
+
+// The property_ keyword is suspended while this header specializes the property_ class.
+#pragma push_macro("property_")
+#undef property_
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief literal_ struct represent a property_ read write attribute for an auto-property usable in constant expressions.
+  struct literal_ : public readwrite_ {};
+
+  /// @brief A literal_ property_ is a read write auto-property of a literal type whose construction, accessors, comparison and compound operators are constexpr.
+  /// @remarks It holds its value and nothing else, and its copy and move are the implicit ones : an owner class whose properties are all literal_ properties is a literal type, and it is trivially copyable when the values are. So it can be built, read and written in constant expressions, and constexpr or constinit owners live in read only data, without static initialization at startup.
+  /// @remarks It has no accessors : use property_<type_t> with #get_ and #set_ when the value must be checked or computed.
+  /// @par Examples
+  /// @code
+  /// struct channel {
+  ///   property_<int, literal_> frequency;
+  ///   property_<double, literal_> gain {1.0};
+  /// };
+  ///
+  /// constexpr channel make_channel(int frequency) {
+  ///   channel result;
+  ///   result.frequency = frequency;
+  ///   result.gain *= 2.0;
+  ///   return result;
+  /// }
+  ///
+  /// constexpr channel channels[] {make_channel(440), make_channel(880)};
+  /// static_assert(channels[1].frequency == 880);
+  /// @endcode
+  template <class type_t>
+  class property_<type_t, literal_> : public literal_ {
+  public:
+    /// @brief This method is an accessor method that retrieves the value of the property_.
+    constexpr const type_t& get() const noexcept {return value;}
+
+    /// @brief This operator is an accessor operator that retrieves the value of the property_.
+    constexpr const type_t& operator()() const noexcept {return value;}
+
+    /// @brief This method is an accessor method that assigns the value of the property_.
+    constexpr const type_t& set(const type_t& value) {this->value = value; return this->value;}
+    /// @brief This method is an accessor method that moves the value into the property_.
+    constexpr const type_t& set(type_t&& value) {this->value = std::move(value); return this->value;}
+
+    /// @brief This method is an accessor method that constructs the value of the property_ from args.
+    template <class... args_t>
+    constexpr const type_t& emplace(args_t&&... args) {value = type_t(std::forward<args_t>(args)...); return value;}
+
+    /// @brief This method is an accessor method that lets function modify the value of the property_ in place.
+    template <class function_t>
+    constexpr const type_t& modify(function_t&& function) {function(value); return value;}
+
+    /// @brief This operator is an accessor operator that assigns the value of the property_.
+    constexpr const type_t& operator()(const type_t& value) {return set(value);}
+    /// @brief This operator is an accessor operator that moves the value into the property_.
+    constexpr const type_t& operator()(type_t&& value) {return set(std::move(value));}
+
+    /// @cond
+    constexpr property_() : value() {}
+    constexpr property_(const type_t& value) : value(value) {}
+    constexpr property_(type_t&& value) : value(std::move(value)) {}
+
+    constexpr operator const type_t&() const noexcept {return value;}
+    constexpr bool operator==(const type_t& value) const {return this->value == value;}
+    constexpr bool operator!=(const type_t& value) const {return this->value != value;}
+
+    constexpr property_& operator=(const type_t& value) {set(value); return *this;}
+    constexpr property_& operator=(type_t&& value) {set(std::move(value)); return *this;}
+    constexpr void operator+=(const type_t& value) {modify(detail::compound_<detail::add_, type_t> {value});}
+    constexpr void operator-=(const type_t& value) {modify(detail::compound_<detail::subtract_, type_t> {value});}
+    constexpr void operator*=(const type_t& value) {modify(detail::compound_<detail::multiply_, type_t> {value});}
+    constexpr void operator /=(const type_t& value) {modify(detail::compound_<detail::divide_, type_t> {value});}
+    constexpr void operator %=(const type_t& value) {modify(detail::compound_<detail::modulus_, type_t> {value});}
+    constexpr void operator &=(const type_t& value) {modify(detail::compound_<detail::bit_and_, type_t> {value});}
+    constexpr void operator |=(const type_t& value) {modify(detail::compound_<detail::bit_or_, type_t> {value});}
+    constexpr void operator ^=(const type_t& value) {modify(detail::compound_<detail::bit_xor_, type_t> {value});}
+    constexpr void operator<<=(const type_t& value) {modify(detail::compound_<detail::left_shift_, type_t> {value});}
+    constexpr void operator>>=(const type_t& value) {modify(detail::compound_<detail::right_shift_, type_t> {value});}
+
+    friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
+    /// @endcond
+
+  private:
+    type_t value;
+  };
+}
+
+#pragma pop_macro("property_")
+
+/// @brief #literal_ represent a property_ read write attribute for an auto-property usable in constant expressions.
+/// @ingroup keywords
+#define literal_ \
+  xtd::literal_
@@ -0,0 +1,230 @@
+/// @file
+/// @brief Contains observable_ attribute, property_<type_t, observable_> class and subscription_ struct.
+#pragma once
+
+#include "properties.h"
+#include <deque>
+#include <memory>
+
+// The property_ keyword is suspended while this header specializes the property_ class.
+#pragma push_macro("property_")
+#undef property_
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief observable_ struct represent a property_ read write attribute whose changes can be observed.
+  struct observable_ : public readwrite_ {};
+
+  /// @brief Identifies a subscription to an observable_ property_. It is returned by subscribe() and given back to unsubscribe().
+  struct subscription_ {
+    /// @brief The identifier of the subscription ; 0 means no subscription.
+    std::size_t id = 0;
+
+    /// @brief Returns true if the subscription is valid.
+    explicit operator bool() const noexcept {return id != 0;}
+  };
+
+  class property_batch_;
+
+  /// @cond
+  namespace detail {
+    template <class type_t, class = void>
+    struct is_equality_comparable_ : std::false_type {};
+
+    template <class type_t>
+    struct is_equality_comparable_<type_t, std::void_t<decltype(std::declval<const type_t&>() == std::declval<const type_t&>())>> : std::true_type {};
+  }
+  /// @endcond
+
+  /// @brief An observable_ property_ is a read write property_ that calls its subscribers with the old and the new value each time it is written.
+  /// @remarks The first two subscribers are stored inline in the property_, the next ones are allocated. While there is no subscriber, a write costs one branch more than the write of a read write property_ ; the old value is only copied when someone listens.
+  /// @remarks skip_unchanged(true) stops the notification when the new value compares equal to the old one.
+  /// @remarks A subscriber can subscribe and unsubscribe while it is called : a subscriber unsubscribed during a notification is not called anymore and is destroyed when the notification ends, and a subscriber added during a notification is called from the next write.
+  /// @par Examples
+  /// @code
+  /// class person {
+  /// public:
+  ///   property_<std::string, observable_> name {"N/A"};
+  /// };
+  ///
+  /// person p;
+  /// auto subscription = p.name.subscribe([](const std::string& old_value, const std::string& new_value) {std::cout << old_value << " -> " << new_value << std::endl;});
+  /// p.name = "Joe"; // Prints "N/A -> Joe".
+  /// p.name.unsubscribe(subscription);
+  /// @endcode
+  template <class type_t>
+  class property_<type_t, observable_> : public observable_ {
+    using getter_type = typename detail::property_value_<type_t>::getter_type;
+    using setter_type = typename detail::property_value_<type_t>::setter_type;
+    using callback_type = detail::accessor_<void(const type_t&, const type_t&)>;
+
+  public:
+    /// @brief This method is an accessor method that retrieves the value of the property_.
+    const type_t& get() const {return getter();}
+
+    /// @brief This operator is an accessor operator that retrieves the value of the property_.
+    const type_t& operator()() const {return getter();}
+
+    /// @brief This method is an accessor method that assigns the value of the property_ and notifies the subscribers.
+    const type_t& set(const type_t& value) {setter(value); return getter();}
+    /// @brief This method is an accessor method that moves the value into the property_ and notifies the subscribers.
+    const type_t& set(type_t&& value) {setter(std::move(value)); return getter();}
+
+    /// @brief This method is an accessor method that constructs the value of the property_ in place from args and notifies the subscribers.
+    template <class... args_t>
+    const type_t& emplace(args_t&&... args) {write([&] {storage.emplace(std::forward<args_t>(args)...);}); return getter();}
+
+    /// @brief This method is an accessor method that lets function modify the value of the property_ in place and notifies the subscribers.
+    template <class function_t>
+    const type_t& modify(function_t&& function) {write([&] {storage.modify(std::forward<function_t>(function));}); return getter();}
+
+    /// @brief This operator is an accessor operator that assigns the value of the property_ and notifies the subscribers.
+    const type_t& operator()(const type_t& value) {setter(value); return getter();}
+    /// @brief This operator is an accessor operator that moves the value into the property_ and notifies the subscribers.
+    const type_t& operator()(type_t&& value) {setter(std::move(value)); return getter();}
+
+    /// @brief Subscribes function, called with the old and the new value after each write.
+    /// @return The subscription to give to unsubscribe().
+    template <class function_t>
+    subscription_ subscribe(function_t&& function) {
+      auto slot = free_slot();
+      slot->id = ++last_id;
+      slot->callback = callback_type(std::forward<function_t>(function));
+      ++subscriber_count;
+      return {slot->id};
+    }
+
+    /// @brief Unsubscribes the given subscription. It can be called from a subscriber.
+    /// @return true if the subscription was found ; otherwise false.
+    bool unsubscribe(subscription_ subscription) {
+      auto slot = find_slot(subscription.id);
+      if (!subscription || !slot) return false;
+      slot->id = 0;
+      if (!notifying) slot->callback = callback_type();
+      --subscriber_count;
+      return true;
+    }
+
+    /// @brief Gets the number of subscribers.
+    std::size_t subscribers() const noexcept {return subscriber_count;}
+
+    /// @brief Sets whether a write that leaves the value equal to the old one is notified (false, the default) or skipped (true).
+    void skip_unchanged(bool skip) noexcept {skip_unchanged_value = skip;}
+
+    /// @cond
+    property_() = default;
+    property_(const type_t& value) : storage(value) {}
+    property_(type_t&& value) : storage(std::move(value)) {}
+    property_(const getter_type& getter, const setter_type& setter) : storage(getter, setter) {}
+    property_(const property_& property) : storage(property.getter()) {}
+
+    operator const type_t&() const {return getter();}
+    property_& operator=(const property_& other) {setter(other.getter()); return *this;}
+    bool operator==(const type_t& value) const {return getter() == value;}
+    bool operator!=(const type_t& value) const {return getter() != value;}
+
+    property_& operator=(const type_t& value) {setter(value); return *this;}
+    property_& operator=(type_t&& value) {setter(std::move(value)); return *this;}
+    void operator+=(const type_t& value) {modify(detail::compound_<detail::add_, type_t> {value});}
+    void operator-=(const type_t& value) {modify(detail::compound_<detail::subtract_, type_t> {value});}
+    void operator*=(const type_t& value) {modify(detail::compound_<detail::multiply_, type_t> {value});}
+    void operator /=(const type_t& value) {modify(detail::compound_<detail::divide_, type_t> {value});}
+    void operator %=(const type_t& value) {modify(detail::compound_<detail::modulus_, type_t> {value});}
+    void operator &=(const type_t& value) {modify(detail::compound_<detail::bit_and_, type_t> {value});}
+    void operator |=(const type_t& value) {modify(detail::compound_<detail::bit_or_, type_t> {value});}
+    void operator ^=(const type_t& value) {modify(detail::compound_<detail::bit_xor_, type_t> {value});}
+    void operator<<=(const type_t& value) {modify(detail::compound_<detail::left_shift_, type_t> {value});}
+    void operator>>=(const type_t& value) {modify(detail::compound_<detail::right_shift_, type_t> {value});}
+
+    friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
+    /// @endcond
+
+  private:
+    friend class property_batch_;
+    static constexpr std::size_t inline_subscriber_count = 2;
+
+    struct subscriber_type {
+      std::size_t id = 0;
+      callback_type callback;
+    };
+
+    // Destroys the callbacks unsubscribed during the notification when the outermost one ends, even if a subscriber throws.
+    struct notify_guard {
+      explicit notify_guard(property_& property) noexcept : property(property) {++property.notifying;}
+      ~notify_guard() {if (--property.notifying == 0) property.release_unsubscribed();}
+      property_& property;
+    };
+
+    const type_t& getter() const {return storage.get();}
+    void setter(const type_t& value) {write([&] {storage.set(value);});}
+    void setter(type_t&& value) {write([&] {storage.set(std::move(value));});}
+
+    template <class write_t>
+    void write(write_t&& write) {
+      if (!subscriber_count) {
+        write();
+        return;
+      }
+      type_t old_value = getter();
+      write();
+      notify(old_value);
+    }
+
+    void notify(const type_t& old_value) {
+      if constexpr (detail::is_equality_comparable_<type_t>::value)
+        if (skip_unchanged_value && old_value == getter()) return;
+      // The slots do not move while they are called, and the subscribers added by a callback have an id above last.
+      notify_guard guard(*this);
+      auto last = last_id;
+      for (auto& subscriber : inline_subscribers)
+        if (subscriber.id && subscriber.id <= last) subscriber.callback(old_value, getter());
+      if (more_subscribers)
+        for (auto index = std::size_t {0}; index < more_subscribers->size(); ++index)
+          if ((*more_subscribers)[index].id && (*more_subscribers)[index].id <= last) (*more_subscribers)[index].callback(old_value, getter());
+    }
+
+    void release_unsubscribed() {
+      for (auto& subscriber : inline_subscribers)
+        if (!subscriber.id) subscriber.callback = callback_type();
+      if (more_subscribers)
+        for (auto& subscriber : *more_subscribers)
+          if (!subscriber.id) subscriber.callback = callback_type();
+    }
+
+    subscriber_type* find_slot(std::size_t id) {
+      for (auto& subscriber : inline_subscribers)
+        if (subscriber.id == id) return &subscriber;
+      if (more_subscribers)
+        for (auto& subscriber : *more_subscribers)
+          if (subscriber.id == id) return &subscriber;
+      return nullptr;
+    }
+
+    // A slot unsubscribed during a notification keeps its callback until the notification ends, so it is not free yet.
+    subscriber_type* free_slot() {
+      for (auto& subscriber : inline_subscribers)
+        if (!subscriber.id && !subscriber.callback) return &subscriber;
+      if (more_subscribers)
+        for (auto& subscriber : *more_subscribers)
+          if (!subscriber.id && !subscriber.callback) return &subscriber;
+      if (!more_subscribers) more_subscribers = std::make_unique<std::deque<subscriber_type>>();
+      more_subscribers->emplace_back();
+      return &more_subscribers->back();
+    }
+
+    detail::property_value_<type_t> storage;
+    std::size_t subscriber_count = 0;
+    subscriber_type inline_subscribers[inline_subscriber_count];
+    std::unique_ptr<std::deque<subscriber_type>> more_subscribers;
+    std::size_t last_id = 0;
+    std::size_t notifying = 0;
+    bool skip_unchanged_value = false;
+  };
+}
+
+#pragma pop_macro("property_")
+
+/// @brief #observable_ represent a property_ read write attribute whose changes can be observed.
+/// @ingroup keywords
+#define observable_ \
+  xtd::observable_
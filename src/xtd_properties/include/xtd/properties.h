@@ -1,9 +1,22 @@
 /// @file
-/// @brief Contains property_ class, #get_ and #set_ keywords.
+/// @brief Contains property_ class, #get_, #set_ and #mutate_ keywords.
 #pragma once
 
-#include <functional>
+#include <cstddef>
+#include <cstring>
+#include <new>
 #include <ostream>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#if defined(XTD_PROPERTIES_INSTRUMENTATION)
+#include "property_instrumentation.h"
+#endif
+
+#if !defined(XTD_PROPERTIES_ACCESSOR_CAPACITY)
+/// @brief The size in bytes of the inline storage of the #get_ and #set_ accessors, rounded up to a multiple of a pointer ; defaults to two pointers. Set it with the XTD_PROPERTIES_ACCESSOR_CAPACITY CMake cache variable.
+#define XTD_PROPERTIES_ACCESSOR_CAPACITY (2 * sizeof(void*))
+#endif
 
 /// @defgroup keywords keywords
 /// @brief Keywords are predefined, reserved identifiers that have special meanings to the compiler.
@@ -20,8 +33,382 @@ namespace xtd {
   struct writeonly_ {};
   
   /// @cond
-  template <class type_t, class attribute_t = readwrite_>
+  namespace detail {
+    constexpr std::size_t accessor_capacity_ = ((XTD_PROPERTIES_ACCESSOR_CAPACITY > sizeof(void*) ? XTD_PROPERTIES_ACCESSOR_CAPACITY : sizeof(void*)) + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+  }
+  /// @endcond
+  
+  /// @brief Tells whether a closure of type function_t given as #get_, #set_ or #mutate_ accessor is stored inline in the property_, without allocation : it must be nothrow copy constructible and at most XTD_PROPERTIES_ACCESSOR_CAPACITY bytes.
+  template <class function_t>
+  constexpr bool is_inline_accessor_ = sizeof(std::decay_t<function_t>) <= detail::accessor_capacity_ && alignof(void*) % alignof(std::decay_t<function_t>) == 0 && std::is_nothrow_copy_constructible<std::decay_t<function_t>>::value;
+  
+  /// @brief Returns function, an accessor closure, after checking at compile time that it is stored inline.
+  /// @remarks It gives the guarantee of XTD_PROPERTIES_NO_HEAP_ACCESSORS to one accessor : that macro changes the accessors of every property_ and must be defined the same way in every translation unit, while inline_accessor_ changes no type and can be used where allocating is not allowed only.
+  /// @par Examples
+  /// @code
+  /// property_<int> value {
+  ///   inline_accessor_(get_ {return value_;}),
+  ///   inline_accessor_(set_ {value_ = value;})
+  /// };
+  /// value.rebind_getter(inline_accessor_(get_ {return other_;}));
+  /// @endcode
+  template <class function_t>
+  constexpr std::decay_t<function_t> inline_accessor_(function_t&& function) {
+    static_assert(is_inline_accessor_<function_t>, "The accessor does not fit the inline storage : its closure must be nothrow copy constructible and at most XTD_PROPERTIES_ACCESSOR_CAPACITY bytes.");
+    return std::forward<function_t>(function);
+  }
+  
+  /// @cond
+  template <class type_t, class attribute_t = readwrite_, class getter_t = void, class setter_t = void>
   class property_;
+  
+  namespace detail {
+    template <class accessor_t, class signature_t>
+    struct accessor_call_;
+    
+    /// @brief Type-erased accessor used by the property_ specializations whose accessors are not known at compile time.
+    /// @remarks The closure is stored once and can be invoked through each of the given signatures (a setter is called with const type_t& and type_t&&).
+    /// @remarks Closures up to XTD_PROPERTIES_ACCESSOR_CAPACITY bytes, two pointers by default (the usual [&] closures of #get_ and #set_), are stored inline and trivially copyable closures are copied without any indirect call ; larger ones are allocated, or rejected at compile time when XTD_PROPERTIES_NO_HEAP_ACCESSORS is defined.
+    /// @remarks rebind() and the copy assignment build the new closure aside and then swap it in, so an exception leaves the accessor unchanged.
+    template <class... signatures_t>
+    class accessor_ : public accessor_call_<accessor_<signatures_t...>, signatures_t>... {
+      template <class accessor_t, class signature_t>
+      friend struct accessor_call_;
+      
+    public:
+      using accessor_call_<accessor_, signatures_t>::operator()...;
+      
+      accessor_() = default;
+      template <class function_t, class = std::enable_if_t<!std::is_same<std::decay_t<function_t>, accessor_>::value>>
+      accessor_(function_t&& function) {assign(std::forward<function_t>(function));}
+      accessor_(const accessor_& other) : table(other.table) {copy_storage(other);}
+      accessor_& operator=(const accessor_& other) {
+        if (this == &other) return *this;
+        accessor_ copy(other);
+        swap(copy);
+        return *this;
+      }
+      ~accessor_() {reset();}
+      
+      explicit operator bool() const noexcept {return table != nullptr;}
+      
+      template <class function_t>
+      void rebind(function_t&& function) {
+        accessor_ replacement(std::forward<function_t>(function));
+        swap(replacement);
+      }
+      
+      void swap(accessor_& other) noexcept {
+        alignas(void*) unsigned char temporary[capacity];
+        relocate(table, storage, temporary);
+        relocate(other.table, other.storage, storage);
+        relocate(table, temporary, other.storage);
+        std::swap(table, other.table);
+      }
+      
+    private:
+      static constexpr std::size_t capacity = accessor_capacity_;
+      
+      template <class function_t>
+      static constexpr bool is_inline = is_inline_accessor_<function_t>;
+      
+      template <class function_t>
+      static function_t& closure(void* storage) noexcept {
+        if constexpr (is_inline<function_t>) return *static_cast<function_t*>(storage);
+        else return **static_cast<function_t**>(storage);
+      }
+      
+      struct table_type {
+        std::tuple<typename accessor_call_<accessor_, signatures_t>::invoker_type...> invokers;
+        void (*copy)(const void*, void*);
+        void (*destroy)(void*);
+        void (*relocate)(void*, void*) noexcept;
+      };
+      
+      template <class function_t>
+      static const table_type* table_for() {
+        if constexpr (is_inline<function_t> && std::is_trivially_copyable<function_t>::value) {
+          static constexpr table_type table {{&accessor_call_<accessor_, signatures_t>::template invoke<function_t>...}, nullptr, nullptr, nullptr};
+          return &table;
+        } else if constexpr (is_inline<function_t>) {
+          static constexpr table_type table {
+            {&accessor_call_<accessor_, signatures_t>::template invoke<function_t>...},
+            [](const void* source, void* target) {new (target) function_t(*static_cast<const function_t*>(source));},
+            [](void* storage) {static_cast<function_t*>(storage)->~function_t();},
+            [](void* source, void* target) noexcept {
+              new (target) function_t(std::move_if_noexcept(*static_cast<function_t*>(source)));
+              static_cast<function_t*>(source)->~function_t();
+            }
+          };
+          return &table;
+        } else {
+          static constexpr table_type table {
+            {&accessor_call_<accessor_, signatures_t>::template invoke<function_t>...},
+            [](const void* source, void* target) {*static_cast<function_t**>(target) = new function_t(**static_cast<function_t* const*>(source));},
+            [](void* storage) {delete *static_cast<function_t**>(storage);},
+            nullptr
+          };
+          return &table;
+        }
+      }
+      
+      template <class function_t>
+      void assign(function_t&& function) {
+        using closure_type = std::decay_t<function_t>;
+#if defined(XTD_PROPERTIES_NO_HEAP_ACCESSORS)
+        static_assert(is_inline<closure_type>, "The accessor does not fit the inline storage : its closure must be nothrow copy constructible and at most XTD_PROPERTIES_ACCESSOR_CAPACITY bytes.");
+#endif
+        if constexpr (is_inline<closure_type>) new (storage) closure_type(std::forward<function_t>(function));
+        else *reinterpret_cast<closure_type**>(storage) = new closure_type(std::forward<function_t>(function));
+        table = table_for<closure_type>();
+      }
+      
+      void copy_storage(const accessor_& other) {
+        if (!table) return;
+        if (table->copy) table->copy(other.storage, storage);
+        else std::memcpy(storage, other.storage, capacity);
+      }
+      
+      void reset() noexcept {
+        if (table && table->destroy) table->destroy(storage);
+        table = nullptr;
+      }
+      
+      // Moves the closure of table from source to target and ends its lifetime in source ; the bytes of trivially copyable closures and of the pointers to allocated ones are just copied.
+      static void relocate(const table_type* table, void* source, void* target) noexcept {
+        if (table && table->relocate) table->relocate(source, target);
+        else std::memcpy(target, source, capacity);
+      }
+      
+      // Zero initialized : relocate() and the copy of a trivially copyable closure copy all the capacity bytes, also those past a smaller closure.
+      alignas(void*) mutable unsigned char storage[capacity] {};
+      const table_type* table = nullptr;
+    };
+    
+    template <class accessor_t, class result_t, class... args_t>
+    struct accessor_call_<accessor_t, result_t(args_t...)> {
+      using invoker_type = result_t (*)(void*, args_t...);
+      
+      template <class function_t>
+      static result_t invoke(void* storage, args_t... args) {
+        static_assert(!std::is_reference<result_t>::value || std::is_reference<std::invoke_result_t<function_t&, args_t...>>::value, "The accessor returns a temporary through a reference, which would dangle : return a field with get_, or compute the value with compute_ and a computed_ property_.");
+        return accessor_t::template closure<function_t>(storage)(std::forward<args_t>(args)...);
+      }
+      
+      result_t operator()(args_t... args) const {
+        auto& self = static_cast<const accessor_t&>(*this);
+        return std::get<invoker_type>(self.table->invokers)(self.storage, std::forward<args_t>(args)...);
+      }
+    };
+    
+    /// @brief Tells whether accessor_t is a #mutate_ accessor (returns a mutable reference to the backing value) rather than a #set_ accessor.
+    template <class type_t, class accessor_t>
+    constexpr bool is_mutator_ = std::is_invocable_r<type_t&, accessor_t&>::value && !std::is_invocable<accessor_t&, const type_t&>::value;
+    
+    /// @brief Gets the value type taken by the call operator of a setter function object ; it is not defined when the call operator is a template, as for a #set_ closure.
+    template <class function_t>
+    struct setter_argument_ {};
+    template <class class_t, class result_t, class argument_t>
+    struct setter_argument_<result_t (class_t::*)(argument_t)> {using type = std::decay_t<argument_t>;};
+    template <class class_t, class result_t, class argument_t>
+    struct setter_argument_<result_t (class_t::*)(argument_t) const> {using type = std::decay_t<argument_t>;};
+    template <class class_t, class result_t, class argument_t>
+    struct setter_argument_<result_t (class_t::*)(argument_t) noexcept> {using type = std::decay_t<argument_t>;};
+    template <class class_t, class result_t, class argument_t>
+    struct setter_argument_<result_t (class_t::*)(argument_t) const noexcept> {using type = std::decay_t<argument_t>;};
+    
+    template <class setter_t>
+    using setter_value_t_ = typename setter_argument_<decltype(&setter_t::operator())>::type;
+    
+    template <class type_t, class setter_t, class value_t>
+    void assign_(setter_t& setter, value_t&& value) {
+      if constexpr (is_mutator_<type_t, setter_t>) setter() = std::forward<value_t>(value);
+      else setter(std::forward<value_t>(value));
+    }
+    
+    /// @brief Adapts a #set_ or #mutate_ closure to the signatures of setter_ ; only a #mutate_ closure gives access to the backing value.
+    template <class type_t, class function_t>
+    struct setter_adapter_ {
+      void operator()(const type_t& value) {assign_<type_t>(function, value);}
+      void operator()(type_t&& value) {assign_<type_t>(function, std::move(value));}
+      type_t* operator()() {
+        if constexpr (is_mutator_<type_t, function_t>) return &function();
+        else return nullptr;
+      }
+      
+      function_t function;
+    };
+    
+    /// @brief Type-erased #set_ or #mutate_ accessor. Invoked without argument, it returns the backing value when the accessor is a #mutate_ one, nullptr otherwise.
+    template <class type_t>
+    class setter_ : public accessor_<void(const type_t&), void(type_t&&), type_t*()> {
+      using base_type = accessor_<void(const type_t&), void(type_t&&), type_t*()>;
+      
+    public:
+      setter_() = default;
+      template <class function_t, class = std::enable_if_t<!std::is_same<std::decay_t<function_t>, setter_>::value>>
+      setter_(function_t&& function) : base_type(setter_adapter_<type_t, std::decay_t<function_t>> {std::forward<function_t>(function)}) {}
+      
+      template <class function_t>
+      void rebind(function_t&& function) {base_type::rebind(setter_adapter_<type_t, std::decay_t<function_t>> {std::forward<function_t>(function)});}
+    };
+    
+    /// @brief The compound operators ; in_place is used when the type has it, otherwise the value is recomputed with apply.
+    struct add_ {
+      template <class a_t, class b_t> static constexpr auto in_place(a_t& a, const b_t& b) -> decltype(a += b) {return a += b;}
+      template <class a_t, class b_t> static constexpr auto apply(const a_t& a, const b_t& b) -> decltype(a + b) {return a + b;}
+    };
+    struct subtract_ {
+      template <class a_t, class b_t> static constexpr auto in_place(a_t& a, const b_t& b) -> decltype(a -= b) {return a -= b;}
+      template <class a_t, class b_t> static constexpr auto apply(const a_t& a, const b_t& b) -> decltype(a - b) {return a - b;}
+    };
+    struct multiply_ {
+      template <class a_t, class b_t> static constexpr auto in_place(a_t& a, const b_t& b) -> decltype(a *= b) {return a *= b;}
+      template <class a_t, class b_t> static constexpr auto apply(const a_t& a, const b_t& b) -> decltype(a * b) {return a * b;}
+    };
+    struct divide_ {
+      template <class a_t, class b_t> static constexpr auto in_place(a_t& a, const b_t& b) -> decltype(a /= b) {return a /= b;}
+      template <class a_t, class b_t> static constexpr auto apply(const a_t& a, const b_t& b) -> decltype(a / b) {return a / b;}
+    };
+    struct modulus_ {
+      template <class a_t, class b_t> static constexpr auto in_place(a_t& a, const b_t& b) -> decltype(a %= b) {return a %= b;}
+      template <class a_t, class b_t> static constexpr auto apply(const a_t& a, const b_t& b) -> decltype(a % b) {return a % b;}
+    };
+    struct bit_and_ {
+      template <class a_t, class b_t> static constexpr auto in_place(a_t& a, const b_t& b) -> decltype(a &= b) {return a &= b;}
+      template <class a_t, class b_t> static constexpr auto apply(const a_t& a, const b_t& b) -> decltype(a & b) {return a & b;}
+    };
+    struct bit_or_ {
+      template <class a_t, class b_t> static constexpr auto in_place(a_t& a, const b_t& b) -> decltype(a |= b) {return a |= b;}
+      template <class a_t, class b_t> static constexpr auto apply(const a_t& a, const b_t& b) -> decltype(a | b) {return a | b;}
+    };
+    struct bit_xor_ {
+      template <class a_t, class b_t> static constexpr auto in_place(a_t& a, const b_t& b) -> decltype(a ^= b) {return a ^= b;}
+      template <class a_t, class b_t> static constexpr auto apply(const a_t& a, const b_t& b) -> decltype(a ^ b) {return a ^ b;}
+    };
+    struct left_shift_ {
+      template <class a_t, class b_t> static constexpr auto in_place(a_t& a, const b_t& b) -> decltype(a <<= b) {return a <<= b;}
+      template <class a_t, class b_t> static constexpr auto apply(const a_t& a, const b_t& b) -> decltype(a << b) {return a << b;}
+    };
+    struct right_shift_ {
+      template <class a_t, class b_t> static constexpr auto in_place(a_t& a, const b_t& b) -> decltype(a >>= b) {return a >>= b;}
+      template <class a_t, class b_t> static constexpr auto apply(const a_t& a, const b_t& b) -> decltype(a >> b) {return a >> b;}
+    };
+    
+    template <class operator_t, class type_t, class = void>
+    struct has_in_place_ : std::false_type {};
+    
+    template <class operator_t, class type_t>
+    struct has_in_place_<operator_t, type_t, std::void_t<decltype(operator_t::in_place(std::declval<type_t&>(), std::declval<const type_t&>()))>> : std::true_type {};
+    
+    /// @brief Function object given to modify() by the compound operators of a property_.
+    template <class operator_t, class type_t>
+    struct compound_ {
+      constexpr void operator()(type_t& target) const {
+        if constexpr (has_in_place_<operator_t, type_t>::value) operator_t::in_place(target, value);
+        else target = operator_t::apply(target, value);
+      }
+      
+      const type_t& value;
+    };
+    
+    /// @brief The type returned by the getter of a member_property_ : a reference to the field or the result of the member function.
+    template <class owner_t, class type_t, class getter_t>
+    struct member_result_ {
+      using type = std::conditional_t<std::is_member_object_pointer<getter_t>::value, const type_t&, std::invoke_result_t<getter_t, const owner_t&>>;
+    };
+    
+    template <class owner_t, class type_t>
+    struct member_result_<owner_t, type_t, std::nullptr_t> {
+      using type = const type_t&;
+    };
+    
+    /// @brief The copy assignment of a read write member_property_ : it assigns the value of the other property_ through the setter. The move assignment does nothing, since the implicit move assignment of the owner has already moved the field ; the moves and the copy construction stay trivial.
+    template <class property_t, bool read_write>
+    struct member_assignment_ {};
+    
+    template <class property_t>
+    struct member_assignment_<property_t, true> {
+      member_assignment_() = default;
+      member_assignment_(const member_assignment_&) = default;
+      member_assignment_(member_assignment_&&) = default;
+      member_assignment_& operator=(const member_assignment_& other) {
+        static_cast<property_t&>(*this).set(static_cast<const property_t&>(other).get());
+        return *this;
+      }
+      member_assignment_& operator=(member_assignment_&&) = default;
+    };
+    
+    /// @brief Holds either the value of an auto-property or the #get_ and #set_ accessors of a property_, never both.
+    template <class type_t>
+    class property_value_ {
+    public:
+      using getter_type = accessor_<const type_t&()>;
+      using setter_type = setter_<type_t>;
+      
+      property_value_() : value() {}
+      property_value_(const type_t& value) : value(value) {}
+      property_value_(type_t&& value) : value(std::move(value)) {}
+      property_value_(const getter_type& getter, const setter_type& setter) : accessors {getter, setter}, active_accessors(&accessors) {}
+      property_value_(const property_value_&) = delete;
+      property_value_& operator=(const property_value_&) = delete;
+      ~property_value_() {
+        if (active_accessors) active_accessors->~accessors_type();
+        else value.~type_t();
+      }
+      
+      const type_t& get() const {return active_accessors ? active_accessors->getter() : value;}
+      void set(const type_t& value) {
+        if (active_accessors) active_accessors->setter(value);
+        else this->value = value;
+      }
+      void set(type_t&& value) {
+        if (active_accessors) active_accessors->setter(std::move(value));
+        else this->value = std::move(value);
+      }
+      template <class... args_t>
+      void emplace(args_t&&... args) {
+        if (active_accessors) active_accessors->setter(type_t(std::forward<args_t>(args)...));
+        else if constexpr (std::is_nothrow_constructible<type_t, args_t&&...>::value) {
+          value.~type_t();
+          new (&value) type_t(std::forward<args_t>(args)...);
+        } else value = type_t(std::forward<args_t>(args)...);
+      }
+      template <class function_t>
+      bool rebind_getter(function_t&& getter) {
+        if (active_accessors) active_accessors->getter.rebind(std::forward<function_t>(getter));
+        return active_accessors != nullptr;
+      }
+      template <class function_t>
+      bool rebind_setter(function_t&& setter) {
+        if (active_accessors) active_accessors->setter.rebind(std::forward<function_t>(setter));
+        return active_accessors != nullptr;
+      }
+      template <class function_t>
+      void modify(function_t&& function) {
+        if (!active_accessors) function(value);
+        else if (auto mutable_value = active_accessors->setter()) function(*mutable_value);
+        else {
+          type_t result = active_accessors->getter();
+          function(result);
+          active_accessors->setter(std::move(result));
+        }
+      }
+      
+    private:
+      struct accessors_type {
+        getter_type getter;
+        setter_type setter;
+      };
+      
+      union {
+        type_t value;
+        accessors_type accessors;
+      };
+      // Points to accessors when they are the active member, nullptr for an auto-property. With a flag instead, GCC reads the bytes of the value as accessors in the branch that is never taken and warns at -O2.
+      accessors_type* active_accessors = nullptr;
+    };
+  }
   /// @endcond
   
   /// @brief A property_ is a member that provides a flexible mechanism to read, write, or compute the value of a private field. Properties can be used as if they are public data members, but they are actually special methods called accessors. This enables data to be accessed easily and still helps promote the safety and flexibility of methods.
@@ -31,8 +418,8 @@ namespace xtd {
   /// @include person.cpp
   template <class type_t>
   class property_<type_t, readwrite_> : public readwrite_ {
-    using getter_type = std::function<const type_t&()>;
-    using setter_type = std::function<void(const type_t&)>;
+    using getter_type = typename detail::property_value_<type_t>::getter_type;
+    using setter_type = typename detail::property_value_<type_t>::setter_type;
     
   public:
     /// @brief This method is an accessor method that retrieves the value of the property_ or the indexer element.
@@ -43,15 +430,38 @@ namespace xtd {
     
     /// @brief This method is an accessor method that assigns the value of the property_ or the indexer element.
     const type_t& set(const type_t& value) {setter(value); return getter();}
+    /// @brief This method is an accessor method that moves the value into the property_ or the indexer element.
+    const type_t& set(type_t&& value) {setter(std::move(value)); return getter();}
+    
+    /// @brief This method is an accessor method that constructs the value of the property_ in place from args (for an auto-property) or constructs it once and moves it into the #set_ accessor.
+    template <class... args_t>
+    const type_t& emplace(args_t&&... args) {storage.emplace(std::forward<args_t>(args)...); return getter();}
+    
+    /// @brief This method is an accessor method that lets function modify the value of the property_ in place.
+    /// @remarks function receives a type_t& : the value of an auto-property, the field returned by the #mutate_ accessor, or a copy of the #get_ result that is then moved into the #set_ accessor.
+    template <class function_t>
+    const type_t& modify(function_t&& function) {storage.modify(std::forward<function_t>(function)); return getter();}
     
     /// @brief This operator is an accessor operator that assigns the value of the property_ or the indexer element.
     const type_t& operator()(const type_t& value) {setter(value); return getter();}
+    /// @brief This operator is an accessor operator that moves the value into the property_ or the indexer element.
+    const type_t& operator()(type_t&& value) {setter(std::move(value)); return getter();}
+    
+    /// @brief Replaces the #get_ accessor of the property_ ; the closure is stored inline, without allocation, when it fits the accessor storage ; inline_accessor_ checks that at compile time. If storing the closure throws, the property_ keeps its accessor.
+    /// @return false, and the property_ is unchanged, if it is an auto-property.
+    template <class function_t>
+    bool rebind_getter(function_t&& getter) {return storage.rebind_getter(std::forward<function_t>(getter));}
+    /// @brief Replaces the #set_ or #mutate_ accessor of the property_ ; the closure is stored inline, without allocation, when it fits the accessor storage ; inline_accessor_ checks that at compile time. If storing the closure throws, the property_ keeps its accessor.
+    /// @return false, and the property_ is unchanged, if it is an auto-property.
+    template <class function_t>
+    bool rebind_setter(function_t&& setter) {return storage.rebind_setter(std::forward<function_t>(setter));}
     
     /// @cond
     property_() = default;
-    property_(const type_t& value) : value(value) {}
-    property_(const getter_type& getter, const setter_type& setter) : getter(getter), setter(setter) {}
-    property_(const property_& property) : value(property.value) {}
+    property_(const type_t& value) : storage(value) {}
+    property_(type_t&& value) : storage(std::move(value)) {}
+    property_(const getter_type& getter, const setter_type& setter) : storage(getter, setter) {}
+    property_(const property_& property) : storage(property.getter()) {}
     
     operator const type_t&() const {return getter();}
     property_& operator=(const property_& other) {setter(other.getter()); return *this;}
@@ -59,31 +469,35 @@ namespace xtd {
     bool operator!=(const type_t& value) const {return getter() != value;}
     
     property_& operator=(const type_t& value) {setter(value); return *this;}
-    void operator+=(const type_t& value) {setter(getter() + value);}
-    void operator-=(const type_t& value) {setter(getter() - value);}
-    void operator*=(const type_t& value) {setter(getter() * value);}
-    void operator /=(const type_t& value) {setter(getter() / value);}
-    void operator %=(const type_t& value) {setter(getter() % value);}
-    void operator &=(const type_t& value) {setter(getter() & value);}
-    void operator |=(const type_t& value) {setter(getter() | value);}
-    void operator ^=(const type_t& value) {setter(getter() ^ value);}
-    void operator<<=(const type_t& value) {setter(getter() << value);}
-    void operator>>=(const type_t& value) {setter(getter() >> value);}
+    property_& operator=(type_t&& value) {setter(std::move(value)); return *this;}
+    void operator+=(const type_t& value) {modify(detail::compound_<detail::add_, type_t> {value});}
+    void operator-=(const type_t& value) {modify(detail::compound_<detail::subtract_, type_t> {value});}
+    void operator*=(const type_t& value) {modify(detail::compound_<detail::multiply_, type_t> {value});}
+    void operator /=(const type_t& value) {modify(detail::compound_<detail::divide_, type_t> {value});}
+    void operator %=(const type_t& value) {modify(detail::compound_<detail::modulus_, type_t> {value});}
+    void operator &=(const type_t& value) {modify(detail::compound_<detail::bit_and_, type_t> {value});}
+    void operator |=(const type_t& value) {modify(detail::compound_<detail::bit_or_, type_t> {value});}
+    void operator ^=(const type_t& value) {modify(detail::compound_<detail::bit_xor_, type_t> {value});}
+    void operator<<=(const type_t& value) {modify(detail::compound_<detail::left_shift_, type_t> {value});}
+    void operator>>=(const type_t& value) {modify(detail::compound_<detail::right_shift_, type_t> {value});}
     
     friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
     /// @endcond
     
   private:
-    type_t value = type_t();
-    getter_type getter = [&] {return value;};
-    setter_type setter = [&](const type_t& value) {this->value = value;};
+    const type_t& getter() const {return storage.get();}
+    void setter(const type_t& value) {storage.set(value);}
+    void setter(type_t&& value) {storage.set(std::move(value));}
+    
+    detail::property_value_<type_t> storage;
   };
   
   /// @cond
-  template <class type_t, class attribute_t>
+  template <class type_t, class attribute_t, class getter_t, class setter_t>
   class property_ {
-    using getter_type = std::function<const type_t&()>;
-    using setter_type = std::function<void(const type_t&)>;
+    static_assert(std::is_void<getter_t>::value && std::is_void<setter_t>::value, "property_ with an owner attribute does not support compile-time accessors");
+    using getter_type = typename detail::property_value_<type_t>::getter_type;
+    using setter_type = typename detail::property_value_<type_t>::setter_type;
     
     friend attribute_t;
     
@@ -94,14 +508,21 @@ namespace xtd {
     
   private:
     const type_t& set(const type_t& value) {setter(value); return getter();}
+    const type_t& set(type_t&& value) {setter(std::move(value)); return getter();}
+    template <class... args_t>
+    const type_t& emplace(args_t&&... args) {storage.emplace(std::forward<args_t>(args)...); return getter();}
+    template <class function_t>
+    const type_t& modify(function_t&& function) {storage.modify(std::forward<function_t>(function)); return getter();}
     
     const type_t& operator()(const type_t& value) {setter(value); return getter();}
+    const type_t& operator()(type_t&& value) {setter(std::move(value)); return getter();}
     
   public:
     property_() = default;
-    property_(const type_t& value) : value(value) {}
-    property_(const getter_type& getter, const setter_type& setter) : getter(getter), setter(setter) {}
-    property_(const property_& property) : value(property.value) {}
+    property_(const type_t& value) : storage(value) {}
+    property_(type_t&& value) : storage(std::move(value)) {}
+    property_(const getter_type& getter, const setter_type& setter) : storage(getter, setter) {}
+    property_(const property_& property) : storage(property.getter()) {}
     
     operator type_t() const {return getter();}
   private:
@@ -112,38 +533,43 @@ namespace xtd {
     
   private:
     property_& operator=(const type_t& value) {setter(value); return *this;}
-    void operator+=(const type_t& value) {setter(getter() + value);}
-    void operator-=(const type_t& value) {setter(getter() - value);}
-    void operator*=(const type_t& value) {setter(getter() * value);}
-    void operator /=(const type_t& value) {setter(getter() / value);}
-    void operator %=(const type_t& value) {setter(getter() % value);}
-    void operator &=(const type_t& value) {setter(getter() & value);}
-    void operator |=(const type_t& value) {setter(getter() | value);}
-    void operator ^=(const type_t& value) {setter(getter() ^ value);}
-    void operator<<=(const type_t& value) {setter(getter() << value);}
-    void operator>>=(const type_t& value) {setter(getter() >> value);}
+    property_& operator=(type_t&& value) {setter(std::move(value)); return *this;}
+    void operator+=(const type_t& value) {modify(detail::compound_<detail::add_, type_t> {value});}
+    void operator-=(const type_t& value) {modify(detail::compound_<detail::subtract_, type_t> {value});}
+    void operator*=(const type_t& value) {modify(detail::compound_<detail::multiply_, type_t> {value});}
+    void operator /=(const type_t& value) {modify(detail::compound_<detail::divide_, type_t> {value});}
+    void operator %=(const type_t& value) {modify(detail::compound_<detail::modulus_, type_t> {value});}
+    void operator &=(const type_t& value) {modify(detail::compound_<detail::bit_and_, type_t> {value});}
+    void operator |=(const type_t& value) {modify(detail::compound_<detail::bit_or_, type_t> {value});}
+    void operator ^=(const type_t& value) {modify(detail::compound_<detail::bit_xor_, type_t> {value});}
+    void operator<<=(const type_t& value) {modify(detail::compound_<detail::left_shift_, type_t> {value});}
+    void operator>>=(const type_t& value) {modify(detail::compound_<detail::right_shift_, type_t> {value});}
     
   public:
     friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
     
   private:
-    type_t value = type_t();
-    getter_type getter = [&] {return value;};
-    setter_type setter = [&](const type_t& value) {this->value = value;};
+    const type_t& getter() const {return storage.get();}
+    void setter(const type_t& value) {storage.set(value);}
+    void setter(type_t&& value) {storage.set(std::move(value));}
+    
+    detail::property_value_<type_t> storage;
   };
   
   template <class type_t>
   class property_<type_t, readonly_> : public readonly_ {
-    using getter_type = std::function<const type_t&()>;
+    using getter_type = detail::accessor_<const type_t&()>;
     
   public:
     explicit property_(const getter_type& getter) : getter(getter) {}
     property_& operator=(const property_&) {return *this;}
     
+    template <class function_t>
+    void rebind_getter(function_t&& getter) {this->getter.rebind(std::forward<function_t>(getter));}
+    
     const type_t& get() const {return getter();}
     const type_t& operator()() const {return getter();}
-    operator type_t() const { return getter(); }
-    operator type_t() { return getter(); }
+    operator const type_t&() const {return getter();}
     bool operator==(const type_t& value) const {return getter() == value;}
     bool operator !=(const type_t& value) const {return getter() != value;}
     
@@ -156,23 +582,281 @@ namespace xtd {
   
   template <class type_t>
   class property_<type_t, writeonly_> : public writeonly_ {
-    using setter_type = std::function<void(type_t)>;
+    using setter_type = detail::setter_<type_t>;
     
   public:
     explicit property_(const setter_type& setter) : setter(setter) {}
     property_& operator=(const property_&) {return *this;}
     
+    template <class function_t>
+    void rebind_setter(function_t&& setter) {this->setter.rebind(std::forward<function_t>(setter));}
+    
     void set(const type_t& value) {setter(value);}
+    void set(type_t&& value) {setter(std::move(value));}
     void operator()(const type_t& value) {setter(value);}
+    void operator()(type_t&& value) {setter(std::move(value));}
     void operator=(const type_t& value) {setter(value);}
+    void operator=(type_t&& value) {setter(std::move(value));}
     
   private:
     property_(const property_&)  = delete;
     setter_type setter;
   };
+  /// @endcond
+  
+  /// @brief A property_ whose accessor types are known at compile time.
+  /// @remarks Unlike property_<type_t, readwrite_>, the #get_ and #set_ closures are stored as is and not type-erased, so get(), operator() and operator= can be inlined down to the field access. No backing value is held: the accessors are the only state.
+  /// @remarks The accessor types of a local or static property_ are deduced from the #get_ and #set_ closures (class template argument deduction). The type of a non-static data member cannot be deduced and a closure type cannot be named in C++17 : a data member uses function objects whose types are named, with typed_property_.
+  /// @remarks A write only property_ deduces its value type from a setter whose call operator is not a template, such as [&](int value) {...} ; a #set_ closure is generic, so the value type is then given : property_<int, writeonly_, void, decltype(setter)>.
+  /// @par Examples
+  /// @code
+  /// int number = 0;
+  /// property_ value {
+  ///   get_ {return number;},
+  ///   set_ {number = value;}
+  /// };
+  /// @endcode
+  template <class type_t, class getter_t, class setter_t>
+  class property_<type_t, readwrite_, getter_t, setter_t> : public readwrite_ {
+    using result_type = std::invoke_result_t<const getter_t&>;
+    
+  public:
+    /// @brief This method is an accessor method that retrieves the value of the property_ or the indexer element.
+    result_type get() const {return getter();}
+    
+    /// @brief This operator is an accessor operator that retrieves the value of the property_ or the indexer element.
+    result_type operator()() const {return getter();}
+    
+    /// @brief This method is an accessor method that assigns the value of the property_ or the indexer element.
+    result_type set(const type_t& value) {detail::assign_<type_t>(setter, value); return getter();}
+    /// @brief This method is an accessor method that moves the value into the property_ or the indexer element.
+    result_type set(type_t&& value) {detail::assign_<type_t>(setter, std::move(value)); return getter();}
+    
+    /// @brief This method is an accessor method that constructs the value once from args and moves it into the #set_ accessor.
+    template <class... args_t>
+    result_type emplace(args_t&&... args) {detail::assign_<type_t>(setter, type_t(std::forward<args_t>(args)...)); return getter();}
+    
+    /// @brief This method is an accessor method that lets function modify the value of the property_ in place.
+    /// @remarks function receives a type_t& : the field returned by the #mutate_ accessor, or a copy of the #get_ result that is then moved into the #set_ accessor.
+    template <class function_t>
+    result_type modify(function_t&& function) {
+      if constexpr (detail::is_mutator_<type_t, setter_t>) function(setter());
+      else {
+        type_t result = getter();
+        function(result);
+        setter(std::move(result));
+      }
+      return getter();
+    }
+    
+    /// @brief This operator is an accessor operator that assigns the value of the property_ or the indexer element.
+    result_type operator()(const type_t& value) {detail::assign_<type_t>(setter, value); return getter();}
+    /// @brief This operator is an accessor operator that moves the value into the property_ or the indexer element.
+    result_type operator()(type_t&& value) {detail::assign_<type_t>(setter, std::move(value)); return getter();}
+    
+    /// @cond
+    property_(getter_t getter, setter_t setter) : getter(std::move(getter)), setter(std::move(setter)) {}
+    property_(const property_&) = delete;
+    
+    operator result_type() const {return getter();}
+    property_& operator=(const property_& other) {detail::assign_<type_t>(setter, other.getter()); return *this;}
+    bool operator==(const type_t& value) const {return getter() == value;}
+    bool operator!=(const type_t& value) const {return getter() != value;}
+    
+    property_& operator=(const type_t& value) {detail::assign_<type_t>(setter, value); return *this;}
+    property_& operator=(type_t&& value) {detail::assign_<type_t>(setter, std::move(value)); return *this;}
+    void operator+=(const type_t& value) {modify(detail::compound_<detail::add_, type_t> {value});}
+    void operator-=(const type_t& value) {modify(detail::compound_<detail::subtract_, type_t> {value});}
+    void operator*=(const type_t& value) {modify(detail::compound_<detail::multiply_, type_t> {value});}
+    void operator /=(const type_t& value) {modify(detail::compound_<detail::divide_, type_t> {value});}
+    void operator %=(const type_t& value) {modify(detail::compound_<detail::modulus_, type_t> {value});}
+    void operator &=(const type_t& value) {modify(detail::compound_<detail::bit_and_, type_t> {value});}
+    void operator |=(const type_t& value) {modify(detail::compound_<detail::bit_or_, type_t> {value});}
+    void operator ^=(const type_t& value) {modify(detail::compound_<detail::bit_xor_, type_t> {value});}
+    void operator<<=(const type_t& value) {modify(detail::compound_<detail::left_shift_, type_t> {value});}
+    void operator>>=(const type_t& value) {modify(detail::compound_<detail::right_shift_, type_t> {value});}
+    
+    friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
+    /// @endcond
+    
+  private:
+    getter_t getter;
+    setter_t setter;
+  };
+  
+  /// @cond
+  template <class type_t, class getter_t>
+  class property_<type_t, readonly_, getter_t, void> : public readonly_ {
+    using result_type = std::invoke_result_t<const getter_t&>;
+    
+  public:
+    explicit property_(getter_t getter) : getter(std::move(getter)) {}
+    property_(const property_&) = delete;
+    property_& operator=(const property_&) {return *this;}
+    
+    result_type get() const {return getter();}
+    result_type operator()() const {return getter();}
+    operator result_type() const {return getter();}
+    bool operator==(const type_t& value) const {return getter() == value;}
+    bool operator !=(const type_t& value) const {return getter() != value;}
+    
+    friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
+    
+  private:
+    getter_t getter;
+  };
+  
+  template <class type_t, class setter_t>
+  class property_<type_t, writeonly_, void, setter_t> : public writeonly_ {
+  public:
+    explicit property_(setter_t setter) : setter(std::move(setter)) {}
+    property_(const property_&) = delete;
+    property_& operator=(const property_&) {return *this;}
+    
+    void set(const type_t& value) {setter(value);}
+    void set(type_t&& value) {setter(std::move(value));}
+    void operator()(const type_t& value) {setter(value);}
+    void operator()(type_t&& value) {setter(std::move(value));}
+    void operator=(const type_t& value) {setter(value);}
+    void operator=(type_t&& value) {setter(std::move(value));}
+    
+  private:
+    setter_t setter;
+  };
+  
+  template <class getter_t, class setter_t>
+  property_(getter_t, setter_t) -> property_<std::decay_t<std::invoke_result_t<const getter_t&>>, readwrite_, getter_t, setter_t>;
+  
+  template <class getter_t, class = std::enable_if_t<std::is_invocable<const getter_t&>::value>>
+  property_(getter_t) -> property_<std::decay_t<std::invoke_result_t<const getter_t&>>, readonly_, getter_t>;
+  
+  template <class setter_t, class = std::enable_if_t<!std::is_invocable<const setter_t&>::value>>
+  property_(setter_t) -> property_<detail::setter_value_t_<setter_t>, writeonly_, void, setter_t>;
+  
+  namespace detail {
+    template <class getter_t, class setter_t>
+    struct typed_property_type_ {
+      using type = property_<std::decay_t<std::invoke_result_t<const getter_t&>>, std::conditional_t<std::is_void<setter_t>::value, readonly_, readwrite_>, getter_t, setter_t>;
+    };
+    
+    template <class setter_t>
+    struct typed_property_type_<void, setter_t> {
+      using type = property_<setter_value_t_<setter_t>, writeonly_, void, setter_t>;
+    };
+  }
+  /// @endcond
+  
+  /// @brief The property_ with compile-time accessors of types getter_t and setter_t : read write, read only when setter_t is void, or write only when getter_t is void.
+  /// @remarks It is the form of property_<type_t, attribute_t, getter_t, setter_t> for non-static data members, whose type cannot be deduced. The value type is the type returned by getter_t, or for a write only property_ the type taken by the call operator of setter_t.
+  /// @par Examples
+  /// @code
+  /// class counter {
+  ///   int value_ = 0;
+  ///   struct get_value {const counter* self; const int& operator()() const {return self->value_;}};
+  ///   struct set_value {counter* self; void operator()(int value) const {self->value_ = value;}};
+  ///
+  /// public:
+  ///   typed_property_<get_value, set_value> value {get_value {this}, set_value {this}};
+  ///   typed_property_<void, set_value> reset {set_value {this}};
+  /// };
+  /// @endcode
+  template <class getter_t, class setter_t = void>
+  using typed_property_ = typename detail::typed_property_type_<getter_t, setter_t>::type;
   
+  /// @brief A member_property_ is a property_ that finds its owner from its own address (its offset in the owner class) instead of capturing the owner's this.
+  /// @remarks A member_property_ holds no state : the value lives in the owner's field and the accessors are given as pointers to a field or to member functions of the owner. So the owner class keeps its implicit copy and move constructors and operators, and can be relocated by a std::vector or sorted without any hand-written special member.
+  /// @remarks a.name = b.name assigns the value of b.name through the setter. So the implicit copy assignment of an owner with read write member properties is not trivial : it copies the fields, then the setters assign the same values again. Its copy and move constructors and its move assignment stay trivial, and an owner whose member properties are all read only stays trivially copyable when its fields are.
+  /// @remarks Use the #member_property_ keyword to declare it ; getter and setter can be a pointer to a field of the owner, a pointer to a const member function returning the value and a pointer to a member function taking the value. The fields and member functions must be declared before the property.
+  /// @par Examples
+  /// @code
+  /// class person {
+  /// private:
+  ///   std::string name_;
+  ///   int age_ = 0;
+  ///   void set_age(int age) {age_ = age < 0 ? 0 : age;}
+  ///
+  /// public:
+  ///   member_property_(person, name, std::string, &person::name_, &person::name_);
+  ///   member_property_(person, age, int, &person::age_, &person::set_age);
+  /// };
+  ///
+  /// std::vector<person> persons(2); // No copy constructor needed.
+  /// persons[0].name = "Joe";
+  /// @endcode
+  template <class owner_t, class offset_t, class type_t, auto getter, auto setter = nullptr>
+  class member_property_ : public std::conditional_t<std::is_null_pointer<decltype(setter)>::value, readonly_, std::conditional_t<std::is_null_pointer<decltype(getter)>::value, writeonly_, readwrite_>>, public detail::member_assignment_<member_property_<owner_t, offset_t, type_t, getter, setter>, !std::is_null_pointer<decltype(getter)>::value && !std::is_null_pointer<decltype(setter)>::value> {
+    using result_type = typename detail::member_result_<owner_t, type_t, decltype(getter)>::type;
+    
+  public:
+    /// @brief This method is an accessor method that retrieves the value of the property_.
+    result_type get() const {return read(owner());}
+
+    /// @brief This operator is an accessor operator that retrieves the value of the property_.
+    result_type operator()() const {return read(owner());}
+
+    /// @brief This method is an accessor method that assigns the value of the property_.
+    void set(const type_t& value) {write(owner(), value);}
+    /// @brief This method is an accessor method that moves the value into the property_.
+    void set(type_t&& value) {write(owner(), std::move(value));}
+
+    /// @brief This method is an accessor method that lets function modify the value of the property_ in place (through a copy when the setter is a member function).
+    template <class function_t>
+    void modify(function_t&& function) {
+      if constexpr (std::is_member_object_pointer<decltype(setter)>::value) function(owner().*setter);
+      else {
+        type_t result = read(owner());
+        function(result);
+        write(owner(), std::move(result));
+      }
+    }
+
+    /// @cond
+    member_property_() = default;
+    member_property_(const member_property_&) = default;
+    member_property_(member_property_&&) = default;
+    member_property_& operator=(const member_property_&) = default;
+    member_property_& operator=(member_property_&&) = default;
+
+    operator result_type() const {return get();}
+    bool operator==(const type_t& value) const {return get() == value;}
+    bool operator!=(const type_t& value) const {return get() != value;}
+
+    member_property_& operator=(const type_t& value) {set(value); return *this;}
+    member_property_& operator=(type_t&& value) {set(std::move(value)); return *this;}
+    void operator+=(const type_t& value) {modify(detail::compound_<detail::add_, type_t> {value});}
+    void operator-=(const type_t& value) {modify(detail::compound_<detail::subtract_, type_t> {value});}
+    void operator*=(const type_t& value) {modify(detail::compound_<detail::multiply_, type_t> {value});}
+    void operator /=(const type_t& value) {modify(detail::compound_<detail::divide_, type_t> {value});}
+    void operator %=(const type_t& value) {modify(detail::compound_<detail::modulus_, type_t> {value});}
+    void operator &=(const type_t& value) {modify(detail::compound_<detail::bit_and_, type_t> {value});}
+    void operator |=(const type_t& value) {modify(detail::compound_<detail::bit_or_, type_t> {value});}
+    void operator ^=(const type_t& value) {modify(detail::compound_<detail::bit_xor_, type_t> {value});}
+    void operator<<=(const type_t& value) {modify(detail::compound_<detail::left_shift_, type_t> {value});}
+    void operator>>=(const type_t& value) {modify(detail::compound_<detail::right_shift_, type_t> {value});}
+
+    friend std::ostream& operator<<(std::ostream& os, const member_property_& p) {return os <<  p();}
+    /// @endcond
+
+  private:
+    static result_type read(const owner_t& owner) {
+      if constexpr (std::is_member_object_pointer<decltype(getter)>::value) return owner.*getter;
+      else return (owner.*getter)();
+    }
+
+    template <class value_t>
+    static void write(owner_t& owner, value_t&& value) {
+      if constexpr (std::is_member_object_pointer<decltype(setter)>::value) owner.*setter = std::forward<value_t>(value);
+      else (owner.*setter)(std::forward<value_t>(value));
+    }
+
+    owner_t& owner() noexcept {return *reinterpret_cast<owner_t*>(reinterpret_cast<char*>(this) - offset_t::offset());}
+    const owner_t& owner() const noexcept {return *reinterpret_cast<const owner_t*>(reinterpret_cast<const char*>(this) - offset_t::offset());}
+  };
+
+  /// @cond
   template<typename type_t>
   using property_read_only_ = property_<type_t, readonly_>;
+
   
   template<typename type_t>
   using property_read_write_only_ = property_<type_t, writeonly_>;
@@ -187,6 +871,30 @@ namespace xtd {
 #define property_ \
   xtd::property_
   
+  /// @brief The #member_property_ keyword declares a member_property_ named name in the owner class : a property_ of type type that reaches its owner through its offset and its accessors through the getter and setter member pointers (setter can be omitted for a read only property_).
+  /// @par Examples
+  /// @code
+  /// class point {
+  /// private:
+  ///   int x_ = 0;
+  ///
+  /// public:
+  ///   member_property_(point, x, int, &point::x_, &point::x_);
+  /// };
+  ///
+  /// static_assert(std::is_trivially_copy_constructible<point>::value);
+  /// @endcode
+  /// @ingroup keywords
+#define member_property_(owner, name, type, ...) \
+  struct name##_offset_ { \
+    static std::size_t offset() noexcept { \
+      XTD_PROPERTIES_IGNORE_INVALID_OFFSETOF_BEGIN_ \
+      return offsetof(owner, name); \
+      XTD_PROPERTIES_IGNORE_INVALID_OFFSETOF_END_ \
+    } \
+  }; \
+  xtd::member_property_<owner, name##_offset_, type, __VA_ARGS__> name
+  
   /// @brief #readonly_  represent a property_ read only attribute.
   /// @ingroup keywords
 #define readonly_ \
@@ -203,6 +911,7 @@ namespace xtd {
   xtd::writeonly_ \
 
   /// @brief The #get_ keyword defines an accessor method in a property_ or indexer that retrieves the value of the property_ or the indexer element.
+  /// @remarks When xtd.properties is built with the XTD_PROPERTIES_INSTRUMENTATION CMake option, each #get_, #set_ and #mutate_ keyword counts its calls ; see property_instrumentation_.
   /// @par Examples
   /// @code
   /// class Person {
@@ -220,10 +929,16 @@ namespace xtd {
   /// };
   /// @endcode
   /// @ingroup keywords
+#if defined(XTD_PROPERTIES_INSTRUMENTATION)
+#define get_ \
+  XTD_PROPERTIES_SITE_("get") ->* [&]() -> const auto&
+#else
 #define get_ \
   [&]() -> const auto&
+#endif
   
   /// @brief The #set_ keyword defines an accessor method in a property_ or indexer that assigns the value of the property_ or the indexer element.
+  /// @remarks value is a forwarding reference : it is an rvalue when the property_ is assigned a temporary, so std::forward<decltype(value)>(value) moves it into the field instead of copying it.
   /// @par Examples
   /// @code
   /// class Person {
@@ -241,11 +956,50 @@ namespace xtd {
   /// };
   /// @endcode
   /// @ingroup keywords
+#if defined(XTD_PROPERTIES_INSTRUMENTATION)
+#define set_ \
+  XTD_PROPERTIES_SITE_("set") ->* [&](auto&& value)
+#else
 #define set_ \
-  [&](const auto& value)
+  [&](auto&& value)
+#endif
+  
+  /// @brief The #mutate_ keyword defines an accessor method in a property_ that returns a mutable reference to the field behind the property_. It can be given instead of #set_ ; modify() and the compound operators then change the field in place instead of copying it through #get_ and #set_.
+  /// @par Examples
+  /// @code
+  /// class logger {
+  /// public:
+  ///   property_<std::string> Log {
+  ///     get_ {return log;},
+  ///     mutate_ {return log;}
+  ///   };
+  ///
+  /// private:
+  ///   std::string log;
+  /// };
+  ///
+  /// logger l;
+  /// l.Log += "started\n"; // Appends to logger::log, no temporary string.
+  /// @endcode
+  /// @ingroup keywords
+#if defined(XTD_PROPERTIES_INSTRUMENTATION)
+#define mutate_ \
+  XTD_PROPERTIES_SITE_("mutate") ->* [&]() -> auto&
+#else
+#define mutate_ \
+  [&]() -> auto&
+#endif
 }
 
 /// @cond
+#if defined(__GNUC__) || defined(__clang__)
+#define XTD_PROPERTIES_IGNORE_INVALID_OFFSETOF_BEGIN_ _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Winvalid-offsetof\"")
+#define XTD_PROPERTIES_IGNORE_INVALID_OFFSETOF_END_ _Pragma("GCC diagnostic pop")
+#else
+#define XTD_PROPERTIES_IGNORE_INVALID_OFFSETOF_BEGIN_
+#define XTD_PROPERTIES_IGNORE_INVALID_OFFSETOF_END_
+#endif
+
 #define property_read_only_ property_read_only_
 
 #define property_read_write_only_ property_read_write_only_
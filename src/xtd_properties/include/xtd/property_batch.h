@@ -0,0 +1,116 @@
+/// @file
+/// @brief Contains property_batch_ class.
+#pragma once
+
+#include "observable_property.h"
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief A property_batch_ stages writes to properties and applies them together on commit(), or discards them on rollback().
+  /// @remarks Writing the same property_ several times in a batch keeps only the last value, so its setter runs once. On commit(), the writes are applied in the order the properties were first staged ; observable_ properties are written without notification and then notified once each, with the value they had before the batch as the old value, after all the writes are applied : a subscriber never sees a half applied batch.
+  /// @remarks A batch that is neither committed nor rolled back is rolled back when destroyed. Any property_ or member_property_ that can be assigned can be staged ; the properties must outlive the batch. A setter that throws during commit() leaves the previous writes applied and the next ones discarded ; the observable_ properties already written are notified before the exception propagates.
+  /// @par Examples
+  /// @code
+  /// class person {
+  /// public:
+  ///   property_<std::string, observable_> name;
+  ///   property_<int, observable_> age;
+  /// };
+  ///
+  /// person p;
+  /// property_batch_ batch;
+  /// batch.set(p.name, "Joe");
+  /// batch.set(p.age, 42);
+  /// batch.commit(); // The subscribers of name and age are notified after both are written.
+  /// @endcode
+  class property_batch_ {
+  public:
+    /// @cond
+    property_batch_() = default;
+    property_batch_(const property_batch_&) = delete;
+    property_batch_& operator=(const property_batch_&) = delete;
+    ~property_batch_() = default;
+    /// @endcond
+
+    /// @brief Stages the write of value to property ; it replaces the value already staged for property.
+    /// @return This batch.
+    template <class property_t, class value_t>
+    property_batch_& set(property_t& property, value_t&& value) {
+      using entry_type = entry_<property_t, std::decay_t<value_t>>;
+      auto entry = std::make_unique<entry_type>(property, std::forward<value_t>(value));
+      for (auto& staged : entries)
+        if (staged->target == &property) {
+          staged = std::move(entry);
+          return *this;
+        }
+      entries.push_back(std::move(entry));
+      return *this;
+    }
+
+    /// @brief Gets the number of properties staged.
+    std::size_t size() const noexcept {return entries.size();}
+
+    /// @brief Applies the staged writes, then notifies the observable_ properties written, and empties the batch.
+    void commit() {
+      auto staged = std::move(entries);
+      entries.clear();
+      for (auto& entry : staged)
+        entry->capture();
+      auto applied = staged.begin();
+      try {
+        for (; applied != staged.end(); ++applied)
+          (*applied)->apply();
+      } catch (...) {
+        std::for_each(staged.begin(), applied, [](auto& entry) {entry->notify();});
+        throw;
+      }
+      for (auto& entry : staged)
+        entry->notify();
+    }
+
+    /// @brief Discards the staged writes.
+    void rollback() noexcept {entries.clear();}
+
+  private:
+    struct entry_base_ {
+      explicit entry_base_(const void* target) noexcept : target(target) {}
+      virtual ~entry_base_() = default;
+      virtual void capture() {}
+      virtual void apply() = 0;
+      virtual void notify() {}
+
+      const void* target;
+    };
+
+    template <class property_t, class value_t, bool observable = std::is_base_of<observable_, property_t>::value>
+    struct entry_ : entry_base_ {
+      template <class argument_t>
+      entry_(property_t& property, argument_t&& value) : entry_base_(&property), property(property), value(std::forward<argument_t>(value)) {}
+      void apply() override {property = std::move(value);}
+
+      property_t& property;
+      value_t value;
+    };
+
+    template <class property_t, class value_t>
+    struct entry_<property_t, value_t, true> : entry_base_ {
+      using type_t = std::decay_t<decltype(std::declval<property_t&>().get())>;
+
+      template <class argument_t>
+      entry_(property_t& property, argument_t&& value) : entry_base_(&property), property(property), value(std::forward<argument_t>(value)) {}
+      void capture() override {if (property.subscriber_count) old_value.emplace(property.get());}
+      void apply() override {property.storage.set(type_t(std::move(value)));}
+      void notify() override {if (old_value) property.notify(*old_value);}
+
+      property_t& property;
+      value_t value;
+      std::optional<type_t> old_value;
+    };
+
+    std::vector<std::unique_ptr<entry_base_>> entries;
+  };
+}
@@ -0,0 +1,298 @@
+/// @file
+/// @brief Contains property_binding_graph_ class.
+#pragma once
+
+#include "observable_property.h"
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @cond
+  namespace detail {
+    template <class property_t, class = void>
+    struct is_subscribable_ : std::false_type {};
+
+    template <class property_t>
+    struct is_subscribable_<property_t, std::void_t<decltype(std::declval<property_t&>().subscribe(std::declval<void (*)()>()))>> : std::true_type {};
+  }
+  /// @endcond
+
+  /// @brief A property_binding_graph_ keeps properties in sync : a target is written from a source (one-way binding), from a function of several sources (computed binding), or two properties are written from each other (two-way binding).
+  /// @remarks The graph subscribes to the sources that can be subscribed (observable_ and cached_ properties) ; changed() tells it that another property_ has been written. A change is propagated in topological order : each binding affected runs once, after all its sources are up to date, so a target never sees a half updated diamond, and only the bindings downstream of the change run.
+  /// @remarks bind() refuses, and returns false, a binding that would create a cycle or give a second binding to a target. A two-way binding makes its two properties one node of the graph ; the property_ written is copied to the other one.
+  /// @remarks The graph is not thread safe. The properties must outlive it : declare it after them in the owner class.
+  /// @par Examples
+  /// @code
+  /// class rectangle {
+  /// public:
+  ///   property_<double, observable_> width;
+  ///   property_<double, observable_> height;
+  ///   property_<double, observable_> area;
+  ///   property_<double, observable_> perimeter;
+  ///   property_<double, observable_> ratio;
+  ///
+  /// private:
+  ///   property_binding_graph_ bindings;
+  ///
+  /// public:
+  ///   rectangle() {
+  ///     bindings.bind(area, [&] {return width() * height();}, width, height);
+  ///     bindings.bind(perimeter, [&] {return 2 * (width() + height());}, width, height);
+  ///     bindings.bind(ratio, [&] {return area() / perimeter();}, area, perimeter); // Computed once per change of width or height.
+  ///   }
+  /// };
+  /// @endcode
+  class property_binding_graph_ {
+  public:
+    /// @cond
+    property_binding_graph_() = default;
+    property_binding_graph_(const property_binding_graph_&) = delete;
+    property_binding_graph_& operator=(const property_binding_graph_&) = delete;
+    ~property_binding_graph_() {
+      for (auto& node : nodes)
+        if (node.unsubscribe) node.unsubscribe();
+    }
+    /// @endcond
+
+    /// @brief Binds target to source : target is assigned the value of source now and each time source changes.
+    /// @return false, and the graph is unchanged, if the binding would create a cycle or target already has a binding.
+    template <class target_t, class source_t>
+    bool bind(target_t& target, source_t& source) {return bind(target, [&source]() -> decltype(auto) {return source.get();}, source);}
+
+    /// @brief Binds target to function : target is assigned the result of function now and each time one of sources changes.
+    /// @return false, and the graph is unchanged, if the binding would create a cycle or target already has a binding.
+    template <class target_t, class function_t, class source_t, class... sources_t>
+    bool bind(target_t& target, function_t&& function, source_t& source, sources_t&... sources) {
+      auto target_group = group_of(&target);
+      if (target_group != npos && nodes[target_group].has_input) return false;
+      for (auto address : {static_cast<const void*>(&source), static_cast<const void*>(&sources)...}) {
+        auto source_group = group_of(address);
+        if (address == &target || (target_group != npos && source_group != npos && reaches(target_group, source_group))) return false;
+      }
+
+      auto index = node_of(target);
+      auto inputs = std::vector<std::size_t> {node_of(source), node_of(sources)...};
+      auto group = nodes[index].group;
+      nodes[group].has_input = true;
+      nodes[index].inputs = inputs;
+      nodes[index].evaluate = [&target, function = std::forward<function_t>(function)] {target = function();};
+      auto rank = std::size_t {0};
+      for (auto input : inputs) {
+        auto& dependents = nodes[nodes[input].group].dependents;
+        if (std::find(dependents.begin(), dependents.end(), index) == dependents.end()) dependents.push_back(index);
+        rank = std::max(rank, nodes[nodes[input].group].rank + 1);
+      }
+      raise(group, rank);
+      schedule(index);
+      propagate();
+      return true;
+    }
+
+    /// @brief Binds first and second to each other : second is assigned the value of first now, and each of them is assigned the value of the other when it changes.
+    /// @return false, and the graph is unchanged, if the binding would create a cycle or both properties already have a binding.
+    template <class first_t, class second_t>
+    bool bind_two_way(first_t& first, second_t& second) {
+      static_assert(std::is_same<std::decay_t<decltype(first.get())>, std::decay_t<decltype(second.get())>>::value, "The properties of a two-way binding must have the same type.");
+      auto first_group = group_of(&first);
+      auto second_group = group_of(&second);
+      if (static_cast<const void*>(&first) == &second || (first_group != npos && first_group == second_group)) return true;
+      if (first_group != npos && second_group != npos) {
+        if (nodes[first_group].has_input && nodes[second_group].has_input) return false;
+        if (reaches(first_group, second_group) || reaches(second_group, first_group)) return false;
+      }
+
+      first_group = nodes[node_of(first)].group;
+      second_group = nodes[node_of(second)].group;
+      auto source = nodes[second_group].has_input ? node_of(second) : node_of(first);
+      auto& merged = nodes[first_group];
+      for (auto member : nodes[second_group].members) {
+        nodes[member].group = first_group;
+        merged.members.push_back(member);
+      }
+      for (auto dependent : nodes[second_group].dependents)
+        if (std::find(merged.dependents.begin(), merged.dependents.end(), dependent) == merged.dependents.end()) merged.dependents.push_back(dependent);
+      merged.has_input = merged.has_input || nodes[second_group].has_input;
+      nodes[second_group].members.clear();
+      nodes[second_group].dependents.clear();
+      nodes[second_group].has_input = false;
+      raise(first_group, nodes[second_group].rank);
+      changed_node(source);
+      return true;
+    }
+
+    /// @brief Removes the one-way or computed binding of target ; target keeps its value.
+    /// @return true if target had a binding ; otherwise false.
+    template <class target_t>
+    bool unbind(target_t& target) {
+      auto iterator = indices.find(&target);
+      if (iterator == indices.end() || !nodes[iterator->second].evaluate) return false;
+      auto index = iterator->second;
+      for (auto input : nodes[index].inputs) {
+        auto& dependents = nodes[nodes[input].group].dependents;
+        dependents.erase(std::remove(dependents.begin(), dependents.end(), index), dependents.end());
+      }
+      nodes[index].inputs.clear();
+      nodes[index].evaluate = evaluate_type();
+      nodes[nodes[index].group].has_input = false;
+      return true;
+    }
+
+    /// @brief Propagates the value of property, a property_ of the graph that has been written and cannot be subscribed to.
+    template <class property_t>
+    void changed(property_t& property) {
+      auto iterator = indices.find(&property);
+      if (iterator != indices.end()) changed_node(iterator->second);
+    }
+
+    /// @brief Gets the number of properties in the graph.
+    std::size_t size() const noexcept {return nodes.size();}
+
+  private:
+    // The function of a computed binding captures its sources and the target : it is kept on the heap, like the nodes, so that any function can be bound, also with XTD_PROPERTIES_NO_HEAP_ACCESSORS.
+    using evaluate_type = std::function<void()>;
+    using copy_type = detail::accessor_<void(const void*)>;
+    using address_type = detail::accessor_<const void*()>;
+    using unsubscribe_type = detail::accessor_<void()>;
+
+    static constexpr std::size_t npos = std::size_t(-1);
+
+    struct node_type {
+      std::size_t group = 0;
+      std::size_t rank = 0;
+      bool has_input = false;
+      bool writing = false;
+      bool queued = false;
+      std::size_t visit = 0;
+      std::vector<std::size_t> members;
+      std::vector<std::size_t> dependents;
+      std::vector<std::size_t> inputs;
+      evaluate_type evaluate;
+      copy_type copy_from;
+      address_type address;
+      unsubscribe_type unsubscribe;
+    };
+
+    // Marks a node as written by the graph, so that its own notification is ignored.
+    struct writing_guard {
+      explicit writing_guard(node_type& node) noexcept : node(node) {node.writing = true;}
+      ~writing_guard() {node.writing = false;}
+      node_type& node;
+    };
+
+    // Gets the group of the node of property, or npos if property is not in the graph ; unlike node_of, it adds nothing, so that a refused binding leaves the graph unchanged.
+    std::size_t group_of(const void* property) const {
+      auto iterator = indices.find(property);
+      return iterator == indices.end() ? npos : nodes[iterator->second].group;
+    }
+
+    template <class property_t>
+    std::size_t node_of(property_t& property) {
+      using value_type = std::decay_t<decltype(property.get())>;
+      auto [iterator, inserted] = indices.emplace(&property, nodes.size());
+      if (!inserted) return iterator->second;
+      auto index = iterator->second;
+      nodes.emplace_back();
+      nodes[index].group = index;
+      nodes[index].members.push_back(index);
+      if constexpr (std::is_lvalue_reference<decltype(property.get())>::value) nodes[index].address = [&property]() -> const void* {return &property.get();};
+      if constexpr (std::is_assignable<property_t&, const value_type&>::value) nodes[index].copy_from = [&property](const void* value) {property = *static_cast<const value_type*>(value);};
+      if constexpr (detail::is_subscribable_<property_t>::value) {
+        auto subscription = property.subscribe([this, index](const auto&...) {changed_node(index);});
+        nodes[index].unsubscribe = [&property, subscription] {property.unsubscribe(subscription);};
+      }
+      return index;
+    }
+
+    // Tells whether to is downstream of from, or is from. The groups visited are marked with the number of the search, so that it costs nothing for the groups it does not reach.
+    bool reaches(std::size_t from, std::size_t to) {
+      auto pending = std::vector<std::size_t> {from};
+      ++visits;
+      while (!pending.empty()) {
+        auto group = pending.back();
+        pending.pop_back();
+        if (group == to) return true;
+        if (nodes[group].visit == visits) continue;
+        nodes[group].visit = visits;
+        for (auto dependent : nodes[group].dependents)
+          pending.push_back(nodes[dependent].group);
+      }
+      return false;
+    }
+
+    // Gives group a rank at least rank, and the groups downstream ranks above it, so that ranks stay a topological order.
+    void raise(std::size_t group, std::size_t rank) {
+      auto pending = std::vector<std::pair<std::size_t, std::size_t>> {{group, rank}};
+      while (!pending.empty()) {
+        auto [current, minimum] = pending.back();
+        pending.pop_back();
+        if (nodes[current].rank >= minimum && current != group) continue;
+        nodes[current].rank = std::max(nodes[current].rank, minimum);
+        for (auto dependent : nodes[current].dependents)
+          pending.push_back({nodes[dependent].group, nodes[current].rank + 1});
+      }
+    }
+
+    void changed_node(std::size_t index) {
+      if (nodes[index].writing) return;
+      synchronize(index);
+      for (auto dependent : nodes[nodes[index].group].dependents)
+        schedule(dependent);
+      propagate();
+    }
+
+    // Copies the value of index to the other members of its two-way group.
+    void synchronize(std::size_t index) {
+      auto group = nodes[index].group;
+      if (nodes[group].members.size() < 2 || !nodes[index].address) return;
+      auto value = nodes[index].address();
+      for (auto member : nodes[group].members)
+        if (member != index && nodes[member].copy_from) {
+          writing_guard guard(nodes[member]);
+          nodes[member].copy_from(value);
+        }
+    }
+
+    void schedule(std::size_t index) {
+      if (nodes[index].queued) return;
+      nodes[index].queued = true;
+      queue.push({nodes[nodes[index].group].rank, index});
+    }
+
+    // Runs the scheduled bindings by increasing rank ; a binding scheduled while propagating is run by the outer call.
+    void propagate() {
+      if (propagating) return;
+      propagating = true;
+      try {
+        while (!queue.empty()) {
+          auto index = queue.top().second;
+          queue.pop();
+          nodes[index].queued = false;
+          if (!nodes[index].evaluate) continue;
+          {
+            writing_guard guard(nodes[index]);
+            nodes[index].evaluate();
+          }
+          synchronize(index);
+          for (auto dependent : nodes[nodes[index].group].dependents)
+            schedule(dependent);
+        }
+      } catch (...) {
+        for (; !queue.empty(); queue.pop())
+          nodes[queue.top().second].queued = false;
+        propagating = false;
+        throw;
+      }
+      propagating = false;
+    }
+
+    std::vector<node_type> nodes;
+    std::unordered_map<const void*, std::size_t> indices;
+    std::priority_queue<std::pair<std::size_t, std::size_t>, std::vector<std::pair<std::size_t, std::size_t>>, std::greater<std::pair<std::size_t, std::size_t>>> queue;
+    std::size_t visits = 0;
+    bool propagating = false;
+  };
+}
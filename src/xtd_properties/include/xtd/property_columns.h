@@ -0,0 +1,270 @@
+/// @file
+/// @brief Contains property_columns_ class.
+#pragma once
+
+#include "property_reflection.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+#if __has_include(<span>)
+#include <span>
+#endif
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @cond
+  namespace detail {
+    // The value of a write only property_, which has no column.
+    struct no_column_ {};
+
+    template <class descriptor_t>
+    using column_value_type_ = std::conditional_t<descriptor_t::can_read, typename descriptor_t::value_type, no_column_>;
+
+    // A column of bool values : std::vector<bool> packs the values in bits, so it has neither bool& elements nor data().
+    class bool_column_ {
+    public:
+      using value_type = bool;
+
+      bool_column_() = default;
+      bool_column_(const bool_column_& other) : values(other.count ? new bool[other.count] : nullptr), count(other.count), capacity(other.count) {std::copy(other.begin(), other.end(), begin());}
+      bool_column_(bool_column_&& other) noexcept : values(std::move(other.values)), count(std::exchange(other.count, 0)), capacity(std::exchange(other.capacity, 0)) {}
+      bool_column_& operator=(bool_column_ other) noexcept {
+        std::swap(values, other.values);
+        std::swap(count, other.count);
+        std::swap(capacity, other.capacity);
+        return *this;
+      }
+
+      std::size_t size() const noexcept {return count;}
+      bool* data() noexcept {return values.get();}
+      const bool* data() const noexcept {return values.get();}
+      bool* begin() noexcept {return values.get();}
+      const bool* begin() const noexcept {return values.get();}
+      bool* end() noexcept {return values.get() + count;}
+      const bool* end() const noexcept {return values.get() + count;}
+      bool& operator[](std::size_t index) noexcept {return values[index];}
+      const bool& operator[](std::size_t index) const noexcept {return values[index];}
+
+      void reserve(std::size_t new_capacity) {
+        if (new_capacity <= capacity) return;
+        auto new_values = std::unique_ptr<bool[]>(new bool[new_capacity]);
+        std::copy(begin(), end(), new_values.get());
+        values = std::move(new_values);
+        capacity = new_capacity;
+      }
+      void resize(std::size_t new_count) {
+        if (new_count > capacity) reserve(std::max(new_count, 2 * capacity));
+        if (new_count > count) std::fill(end(), begin() + new_count, false);
+        count = new_count;
+      }
+      void clear() noexcept {count = 0;}
+
+    private:
+      std::unique_ptr<bool[]> values;
+      std::size_t count = 0;
+      std::size_t capacity = 0;
+    };
+
+    template <class type_t>
+    struct column_ {using type = std::vector<type_t>;};
+    template <>
+    struct column_<bool> {using type = bool_column_;};
+
+    template <class descriptors_t, class = std::make_index_sequence<std::tuple_size<descriptors_t>::value>>
+    struct columns_;
+
+    template <class descriptors_t, std::size_t... indices>
+    struct columns_<descriptors_t, std::index_sequence<indices...>> {
+      using type = std::tuple<typename column_<column_value_type_<std::tuple_element_t<indices, descriptors_t>>>::type...>;
+
+      template <auto member>
+      static constexpr std::size_t index_of() noexcept {
+        auto result = sizeof...(indices);
+        ((result = result == sizeof...(indices) && matches<member, std::tuple_element_t<indices, descriptors_t>>() ? indices : result), ...);
+        return result;
+      }
+
+      template <auto member, class descriptor_t>
+      static constexpr bool matches() noexcept {
+        if constexpr (std::is_same<decltype(member), std::remove_const_t<decltype(descriptor_t::pointer)>>::value) return member == descriptor_t::pointer;
+        else return false;
+      }
+    };
+  }
+  /// @endcond
+
+  /// @brief A property_columns_ stores the properties of many instances of an owner class, a class that uses #reflect_properties_, as one contiguous column per property instead of an array of owners.
+  /// @remarks Scanning one property over all the rows reads one contiguous array, which keeps the cache and the vector units busy. A column is selected at compile time by the pointer to the property_ member : at<&particle::x>(row) returns an element that has the get(), set(), operator= and compound operators of a property_, and data<&particle::x>(), transform<&particle::x>() and fill<&particle::x>() work on the whole column.
+  /// @remarks A bool column holds one bool per row, not one bit as std::vector<bool> does, so that its elements and data() are real bool objects.
+  /// @remarks The columns hold the values, not owners : the accessors of the owner class run only in store() and load(), which copy a row from and to an owner. Write only properties have no column.
+  /// @par Examples
+  /// @code
+  /// class particle {
+  /// public:
+  ///   property_<float> x;
+  ///   property_<float> speed;
+  ///   reflect_properties_(particle, x, speed);
+  /// };
+  ///
+  /// property_columns_<particle> particles;
+  /// particles.resize(100000);
+  /// particles.fill<&particle::speed>(2.f);
+  /// particles.at<&particle::x>(0) = 1.f;
+  /// auto speed = particles.data<&particle::speed>();
+  /// particles.transform<&particle::x>([&](float& x, std::size_t row) {x += speed[row];});
+  /// @endcode
+  template <class owner_t>
+  class property_columns_ {
+    using descriptors_type = decltype(properties_of_<owner_t>());
+    using columns_type = detail::columns_<descriptors_type>;
+
+    template <auto member>
+    static constexpr std::size_t index_of = columns_type::template index_of<member>();
+
+  public:
+    /// @brief The element of a column at a row ; it has the interface of a read write property_.
+    template <class type_t>
+    class element_ {
+    public:
+      /// @brief Retrieves the value of the element.
+      const type_t& get() const noexcept {return *value;}
+      /// @brief Assigns the value of the element.
+      void set(const type_t& new_value) {*value = new_value;}
+      /// @brief Moves new_value into the element.
+      void set(type_t&& new_value) {*value = std::move(new_value);}
+      /// @brief Lets function modify the value of the element in place.
+      template <class function_t>
+      void modify(function_t&& function) {function(*value);}
+
+      /// @cond
+      explicit element_(type_t& value) noexcept : value(&value) {}
+
+      const type_t& operator()() const noexcept {return *value;}
+      operator const type_t&() const noexcept {return *value;}
+      element_& operator=(const element_& other) {set(other.get()); return *this;}
+      element_& operator=(const type_t& new_value) {set(new_value); return *this;}
+      element_& operator=(type_t&& new_value) {set(std::move(new_value)); return *this;}
+      bool operator==(const type_t& other) const {return *value == other;}
+      bool operator!=(const type_t& other) const {return *value != other;}
+
+      void operator+=(const type_t& operand) {modify(detail::compound_<detail::add_, type_t> {operand});}
+      void operator-=(const type_t& operand) {modify(detail::compound_<detail::subtract_, type_t> {operand});}
+      void operator*=(const type_t& operand) {modify(detail::compound_<detail::multiply_, type_t> {operand});}
+      void operator /=(const type_t& operand) {modify(detail::compound_<detail::divide_, type_t> {operand});}
+      void operator %=(const type_t& operand) {modify(detail::compound_<detail::modulus_, type_t> {operand});}
+      void operator &=(const type_t& operand) {modify(detail::compound_<detail::bit_and_, type_t> {operand});}
+      void operator |=(const type_t& operand) {modify(detail::compound_<detail::bit_or_, type_t> {operand});}
+      void operator ^=(const type_t& operand) {modify(detail::compound_<detail::bit_xor_, type_t> {operand});}
+      void operator<<=(const type_t& operand) {modify(detail::compound_<detail::left_shift_, type_t> {operand});}
+      void operator>>=(const type_t& operand) {modify(detail::compound_<detail::right_shift_, type_t> {operand});}
+
+      friend std::ostream& operator<<(std::ostream& os, const element_& e) {return os << e.get();}
+      /// @endcond
+
+    private:
+      type_t* value;
+    };
+
+    /// @brief Gets the number of rows.
+    std::size_t size() const noexcept {return std::get<0>(columns).size();}
+    /// @brief Gets whether there is no row.
+    bool empty() const noexcept {return size() == 0;}
+
+    /// @brief Reserves room for count rows in each column.
+    void reserve(std::size_t count) {std::apply([&](auto&... column) {(column.reserve(count), ...);}, columns);}
+    /// @brief Sets the number of rows ; new rows hold default values.
+    void resize(std::size_t count) {std::apply([&](auto&... column) {(column.resize(count), ...);}, columns);}
+    /// @brief Removes all the rows.
+    void clear() noexcept {std::apply([&](auto&... column) {(column.clear(), ...);}, columns);}
+
+    /// @brief Appends a row holding the values of the readable properties of owner.
+    void push_back(const owner_t& owner) {
+      resize(size() + 1);
+      store(size() - 1, owner);
+    }
+
+    /// @brief Copies the values of the readable properties of owner to row.
+    void store(std::size_t row, const owner_t& owner) {
+      for_each_column([&](auto descriptor, auto& column) {
+        if constexpr (decltype(descriptor)::can_read) column[row] = descriptor.get(owner);
+      });
+    }
+
+    /// @brief Assigns the values of row to the read write properties of owner, through their setters.
+    void load(std::size_t row, owner_t& owner) const {
+      for_each_column([&](auto descriptor, const auto& column) {
+        if constexpr (decltype(descriptor)::can_read && decltype(descriptor)::can_write) descriptor.set(owner, column[row]);
+      });
+    }
+
+    /// @brief Gets the element of the property member at row.
+    template <auto member>
+    auto at(std::size_t row) {
+      auto& column = column_of<member>();
+      return element_<typename std::decay_t<decltype(column)>::value_type>(column[row]);
+    }
+
+    /// @brief Retrieves the value of the property member at row.
+    template <auto member>
+    const auto& get(std::size_t row) const {return column_of<member>()[row];}
+
+    /// @brief Gets the contiguous column of the property member ; it holds size() values.
+    template <auto member>
+    auto data() noexcept {return column_of<member>().data();}
+    /// @brief Gets the contiguous column of the property member ; it holds size() values.
+    template <auto member>
+    auto data() const noexcept {return column_of<member>().data();}
+
+#if defined(__cpp_lib_span)
+    /// @brief Gets the column of the property member.
+    template <auto member>
+    auto column() noexcept {return std::span(column_of<member>());}
+    /// @brief Gets the column of the property member.
+    template <auto member>
+    auto column() const noexcept {return std::span(column_of<member>());}
+#endif
+
+    /// @brief Calls function with each value of the column of the property member, and its row if function takes two arguments. The loop runs over contiguous memory and function is inlined, so it can be vectorized.
+    template <auto member, class function_t>
+    void transform(function_t&& function) {
+      auto& column = column_of<member>();
+      auto values = column.data();
+      auto count = column.size();
+      for (auto row = std::size_t {0}; row < count; ++row) {
+        if constexpr (std::is_invocable<function_t&, decltype(values[row]), std::size_t>::value) function(values[row], row);
+        else function(values[row]);
+      }
+    }
+
+    /// @brief Assigns value to every row of the column of the property member.
+    template <auto member, class value_t>
+    void fill(const value_t& value) {
+      auto& column = column_of<member>();
+      std::fill(column.begin(), column.end(), value);
+    }
+
+  private:
+    template <auto member>
+    auto& column_of() noexcept {
+      static_assert(index_of<member> < std::tuple_size<descriptors_type>::value, "member is not a property registered with reflect_properties_.");
+      return std::get<index_of<member>>(columns);
+    }
+    template <auto member>
+    const auto& column_of() const noexcept {
+      static_assert(index_of<member> < std::tuple_size<descriptors_type>::value, "member is not a property registered with reflect_properties_.");
+      return std::get<index_of<member>>(columns);
+    }
+
+    template <class function_t>
+    void for_each_column(function_t&& function) {for_each_column(std::forward<function_t>(function), std::make_index_sequence<std::tuple_size<descriptors_type>::value> {});}
+    template <class function_t>
+    void for_each_column(function_t&& function) const {for_each_column(std::forward<function_t>(function), std::make_index_sequence<std::tuple_size<descriptors_type>::value> {});}
+
+    template <class function_t, std::size_t... indices>
+    void for_each_column(function_t&& function, std::index_sequence<indices...>) {(function(std::tuple_element_t<indices, descriptors_type> {}, std::get<indices>(columns)), ...);}
+    template <class function_t, std::size_t... indices>
+    void for_each_column(function_t&& function, std::index_sequence<indices...>) const {(function(std::tuple_element_t<indices, descriptors_type> {}, std::get<indices>(columns)), ...);}
+
+    typename columns_type::type columns;
+  };
+}
@@ -0,0 +1,93 @@
+/// @file
+/// @brief Contains to_chars_ function and std::formatter specializations for property_ and member_property_.
+#pragma once
+
+#include "property_reflection.h"
+#include <charconv>
+#include <cstdio>
+#include <string_view>
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @cond
+  namespace detail {
+    template <class property_t, class = void>
+    struct is_property_ : std::false_type {};
+
+    template <class property_t>
+    struct is_property_<property_t, std::void_t<typename property_value_type_<property_t>::type>> : std::true_type {};
+
+    inline std::to_chars_result copy_chars_(char* first, char* last, std::string_view text) noexcept {
+      if (static_cast<std::size_t>(last - first) < text.size()) return {last, std::errc::value_too_large};
+      std::memcpy(first, text.data(), text.size());
+      return {first + text.size(), std::errc {}};
+    }
+
+    template <class type_t>
+    std::to_chars_result format_value_(char* first, char* last, const type_t& value) {
+      if constexpr (std::is_same<type_t, bool>::value) return copy_chars_(first, last, value ? "true" : "false");
+      else if constexpr (std::is_same<type_t, char>::value) return copy_chars_(first, last, std::string_view(&value, 1));
+      else if constexpr (std::is_integral<type_t>::value) return std::to_chars(first, last, value);
+#if defined(__cpp_lib_to_chars)
+      else if constexpr (std::is_floating_point<type_t>::value) return std::to_chars(first, last, value);
+#else
+      else if constexpr (std::is_floating_point<type_t>::value) {
+        char buffer[32];
+        auto count = std::snprintf(buffer, sizeof(buffer), "%.17g", static_cast<double>(value));
+        return copy_chars_(first, last, std::string_view(buffer, count < 0 ? 0 : static_cast<std::size_t>(count)));
+      }
+#endif
+      else if constexpr (std::is_convertible<const type_t&, std::string_view>::value) return copy_chars_(first, last, std::string_view(value));
+      else static_assert(std::is_void<type_t>::value, "to_chars_ formats properties of arithmetic and string types.");
+    }
+  }
+  /// @endcond
+
+  /// @brief Writes the value of property, a property_ or a member_property_ of arithmetic or string type, as text into the range [first, last) ; like std::to_chars, the text is not null terminated.
+  /// @return The std::to_chars_result of the conversion : ptr is one past the last character written and ec is std::errc::value_too_large if the range is too small.
+  /// @remarks The conversion uses std::to_chars : it does not depend on the locale, does not allocate and does not need a stream. bool is written as true or false and char as itself.
+  /// @par Examples
+  /// @code
+  /// char buffer[64];
+  /// auto result = to_chars_(buffer, buffer + sizeof(buffer), p.age);
+  /// log.write(buffer, result.ptr - buffer);
+  /// @endcode
+  template <class property_t, class = std::enable_if_t<detail::is_property_<property_t>::value>>
+  std::to_chars_result to_chars_(char* first, char* last, const property_t& property) {
+    const typename detail::property_value_type_<property_t>::type& value = property.get();
+    return detail::format_value_(first, last, value);
+  }
+}
+
+#if defined(__cpp_lib_format)
+// The property_ keyword is suspended while this header specializes std::formatter for the property_ class.
+#pragma push_macro("property_")
+#undef property_
+
+/// @cond
+namespace std {
+  template <class type_t, class attribute_t, class getter_t, class setter_t, class char_t>
+  struct formatter<xtd::property_<type_t, attribute_t, getter_t, setter_t>, char_t> : formatter<type_t, char_t> {
+    template <class context_t>
+    auto format(const xtd::property_<type_t, attribute_t, getter_t, setter_t>& property, context_t& context) const {
+      const type_t& value = property.get();
+      return formatter<type_t, char_t>::format(value, context);
+    }
+  };
+
+  template <class owner_t, class offset_t, class type_t, auto getter, auto setter, class char_t>
+  struct formatter<xtd::member_property_<owner_t, offset_t, type_t, getter, setter>, char_t> : formatter<type_t, char_t> {
+    template <class context_t>
+    auto format(const xtd::member_property_<owner_t, offset_t, type_t, getter, setter>& property, context_t& context) const {
+      const type_t& value = property.get();
+      return formatter<type_t, char_t>::format(value, context);
+    }
+  };
+}
+/// @endcond
+
+#pragma pop_macro("property_")
+#endif
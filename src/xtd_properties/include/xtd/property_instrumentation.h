@@ -0,0 +1,160 @@
+/// @file
+/// @brief Contains property_instrumentation_ class.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief The statistics of one accessor call site : a #get_, #set_ or #mutate_ keyword written in the source code, when xtd.properties is built with the XTD_PROPERTIES_INSTRUMENTATION option.
+  struct property_site_ {
+    /// @brief The number of latency histogram buckets ; bucket i counts the sampled calls that lasted less than 2^(i+1) nanoseconds.
+    static constexpr std::size_t bucket_count = 32;
+
+    /// @cond
+    property_site_(const char* file, int line, const char* kind) noexcept;
+    property_site_(const property_site_&) = delete;
+    property_site_& operator=(const property_site_&) = delete;
+
+    void record(std::chrono::nanoseconds duration) noexcept {
+      auto nanoseconds = static_cast<std::uint64_t>(duration.count());
+      auto bucket = std::size_t {0};
+      while (nanoseconds >>= 1) ++bucket;
+      buckets[bucket < bucket_count ? bucket : bucket_count - 1].fetch_add(1, std::memory_order_relaxed);
+    }
+    /// @endcond
+
+    /// @brief The source file of the accessor.
+    const char* file;
+    /// @brief The source line of the accessor.
+    int line;
+    /// @brief The keyword of the accessor : get, set or mutate.
+    const char* kind;
+    /// @brief The number of calls of the accessor.
+    std::atomic<std::uint64_t> calls {0};
+    /// @brief The latency histogram of the sampled calls.
+    std::atomic<std::uint64_t> buckets[bucket_count] {};
+    /// @brief The next call site.
+    property_site_* next = nullptr;
+  };
+
+  /// @brief The property_instrumentation_ class gives access to the call counters and latency histograms of the property_ accessors.
+  /// @remarks When xtd.properties is built with the XTD_PROPERTIES_INSTRUMENTATION CMake option, each #get_, #set_ and #mutate_ keyword of the program becomes a call site that counts its calls with a relaxed atomic increment and, when sample_every() is not 0, measures the duration of one call out of n. Without the option the keywords are unchanged, no site is ever registered and xtd.properties does not include this header : include it to call property_instrumentation_ in both builds.
+  /// @par Examples
+  /// @code
+  /// property_instrumentation_::sample_every(64);
+  /// run_workload();
+  /// property_instrumentation_::report(std::cout);
+  /// @endcode
+  class property_instrumentation_ {
+  public:
+    /// @brief true if xtd.properties is built with the XTD_PROPERTIES_INSTRUMENTATION option.
+#if defined(XTD_PROPERTIES_INSTRUMENTATION)
+    static constexpr bool enabled = true;
+#else
+    static constexpr bool enabled = false;
+#endif
+
+    /// @brief Measures the duration of one call out of every calls at each call site ; 0, the default, measures none.
+    static void sample_every(std::size_t every) noexcept {sampling().store(every, std::memory_order_relaxed);}
+    /// @brief Gets how often the duration of a call is measured.
+    static std::size_t sample_every() noexcept {return sampling().load(std::memory_order_relaxed);}
+
+    /// @brief Calls function with each call site that has been reached.
+    template <class function_t>
+    static void for_each_site(function_t&& function) {
+      for (auto site = head().load(std::memory_order_acquire); site; site = site->next)
+        function(static_cast<const property_site_&>(*site));
+    }
+
+    /// @brief Sets the counters and the histograms of all the call sites to 0.
+    static void reset() noexcept {
+      for (auto site = head().load(std::memory_order_acquire); site; site = site->next) {
+        site->calls.store(0, std::memory_order_relaxed);
+        for (auto& bucket : site->buckets)
+          bucket.store(0, std::memory_order_relaxed);
+      }
+    }
+
+    /// @brief Writes one line per call site : its location, its keyword, its number of calls and, when calls were sampled, their number and the bucket of their median duration.
+    static void report(std::ostream& os) {
+      for_each_site([&](const property_site_& site) {
+        os << site.file << ":" << site.line << " " << site.kind << " calls=" << site.calls.load(std::memory_order_relaxed);
+        auto sampled = std::uint64_t {0};
+        for (const auto& bucket : site.buckets)
+          sampled += bucket.load(std::memory_order_relaxed);
+        if (sampled) {
+          auto seen = std::uint64_t {0};
+          auto median = std::size_t {0};
+          while ((seen += site.buckets[median].load(std::memory_order_relaxed)) * 2 < sampled) ++median;
+          os << " sampled=" << sampled << " median<" << (std::uint64_t {2} << median) << "ns";
+        }
+        os << "\n";
+      });
+    }
+
+  private:
+    friend struct property_site_;
+
+    static std::atomic<property_site_*>& head() noexcept {
+      static std::atomic<property_site_*> sites {nullptr};
+      return sites;
+    }
+
+    static std::atomic<std::size_t>& sampling() noexcept {
+      static std::atomic<std::size_t> every {0};
+      return every;
+    }
+  };
+
+  inline property_site_::property_site_(const char* file, int line, const char* kind) noexcept : file(file), line(line), kind(kind) {
+    auto& head = property_instrumentation_::head();
+    next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  /// @cond
+  namespace detail {
+    // The call site of an accessor : site_t is the captureless closure that returns its property_site_, so that the counted accessor has the size of the accessor it wraps.
+    template <class site_t>
+    struct property_site_tag_ : site_t {
+      explicit property_site_tag_(site_t site) : site_t(site) {}
+    };
+
+    template <class site_t, class function_t>
+    struct counted_accessor_ : site_t {
+      counted_accessor_(site_t site, function_t function) : site_t(site), function(std::move(function)) {}
+
+      template <class... args_t>
+      auto operator()(args_t&&... args) const -> decltype(std::declval<const function_t&>()(std::forward<args_t>(args)...)) {
+        auto& site = static_cast<const site_t&>(*this)();
+        auto call = site.calls.fetch_add(1, std::memory_order_relaxed);
+        auto every = property_instrumentation_::sample_every();
+        if (!every || call % every) return function(std::forward<args_t>(args)...);
+        struct timer_type {
+          ~timer_type() {site.record(std::chrono::steady_clock::now() - start);}
+          property_site_& site;
+          std::chrono::steady_clock::time_point start;
+        } timer {site, std::chrono::steady_clock::now()};
+        return function(std::forward<args_t>(args)...);
+      }
+
+      function_t function;
+    };
+
+    template <class site_t, class function_t>
+    counted_accessor_<site_t, std::decay_t<function_t>> operator->*(property_site_tag_<site_t> site, function_t&& function) {return {site, std::forward<function_t>(function)};}
+  }
+  /// @endcond
+}
+
+/// @cond
+#define XTD_PROPERTIES_SITE_(kind) \
+  xtd::detail::property_site_tag_([]() -> xtd::property_site_& {static xtd::property_site_ site {__FILE__, __LINE__, kind}; return site;})
+/// @endcond
@@ -0,0 +1,206 @@
+/// @file
+/// @brief Contains property_descriptor_ class, properties_of_, for_each_property_ and the #reflect_properties_ keyword.
+#pragma once
+
+#include "properties.h"
+#include <string_view>
+#include <tuple>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @cond
+  namespace detail {
+    template <class property_t>
+    struct property_value_type_;
+
+    template <class type_t, class attribute_t, class getter_t, class setter_t>
+    struct property_value_type_<property_<type_t, attribute_t, getter_t, setter_t>> {using type = type_t;};
+
+    template <class owner_t, class offset_t, class type_t, auto getter, auto setter>
+    struct property_value_type_<member_property_<owner_t, offset_t, type_t, getter, setter>> {using type = type_t;};
+
+    // Gives the generic functions access to the descriptors of an owner class even when #reflect_properties_ is in a private section.
+    struct reflection_access_ {
+      template <class owner_t>
+      static constexpr auto properties() noexcept {return owner_t::xtd_properties_reflect_();}
+
+      template <class owner_t, class = void>
+      struct is_reflectable : std::false_type {};
+
+      template <class owner_t>
+      struct is_reflectable<owner_t, std::void_t<decltype(owner_t::xtd_properties_reflect_())>> : std::true_type {};
+    };
+  }
+  /// @endcond
+
+  /// @brief A property_descriptor_ describes at compile time a property_ member of an owner class : its name, its value type, its attribute and how to access it.
+  /// @remarks Descriptors are created by the #reflect_properties_ keyword ; everything but the name is part of the type, so generic code can select with if constexpr.
+  template <class owner_t, class property_t, property_t owner_t::* member>
+  struct property_descriptor_ {
+    /// @brief The owner class.
+    using owner_type = owner_t;
+    /// @brief The type of the property_ member.
+    using property_type = property_t;
+    /// @brief The type of the value of the property_.
+    using value_type = typename detail::property_value_type_<property_t>::type;
+    /// @brief The attribute of the property_ as seen from outside the owner class : readonly_, readwrite_ or writeonly_.
+    using attribute_type = std::conditional_t<std::is_base_of<writeonly_, property_t>::value, writeonly_, std::conditional_t<std::is_base_of<readwrite_, property_t>::value, readwrite_, readonly_>>;
+
+    /// @brief true if the property_ can be read.
+    static constexpr bool can_read = !std::is_same<attribute_type, writeonly_>::value;
+    /// @brief true if the property_ can be written.
+    static constexpr bool can_write = !std::is_same<attribute_type, readonly_>::value;
+    /// @brief The pointer to the property_ member.
+    static constexpr property_t owner_t::* pointer = member;
+
+    /// @brief Gets the property_ of owner.
+    static constexpr property_t& access(owner_t& owner) noexcept {return owner.*member;}
+    /// @brief Gets the property_ of owner.
+    static constexpr const property_t& access(const owner_t& owner) noexcept {return owner.*member;}
+
+    /// @brief Retrieves the value of the property_ of owner.
+    static decltype(auto) get(const owner_t& owner) {return (owner.*member).get();}
+
+    /// @brief Assigns value to the property_ of owner.
+    template <class value_t>
+    static void set(owner_t& owner, value_t&& value) {owner.*member = std::forward<value_t>(value);}
+
+    /// @brief The name of the property_ member.
+    std::string_view name;
+  };
+
+  /// @brief Tells whether owner_t registers its properties with #reflect_properties_.
+  template <class owner_t>
+  constexpr bool is_reflectable_ = detail::reflection_access_::is_reflectable<owner_t>::value;
+
+  /// @brief Gets the std::tuple of the property_descriptor_ of the properties of owner_t, in the order of #reflect_properties_.
+  template <class owner_t>
+  constexpr auto properties_of_() noexcept {return detail::reflection_access_::properties<owner_t>();}
+
+  /// @brief Gets the number of properties registered by owner_t.
+  template <class owner_t>
+  constexpr std::size_t property_count_ = std::tuple_size<decltype(properties_of_<owner_t>())>::value;
+
+  /// @brief Calls function with the property_descriptor_ of each property of owner_t. The calls are unrolled at compile time.
+  template <class owner_t, class function_t>
+  constexpr void for_each_property_(function_t&& function) {
+    std::apply([&](auto... descriptors) {(function(descriptors), ...);}, properties_of_<owner_t>());
+  }
+
+  /// @brief Calls function with the property_descriptor_ and the property_ of each property of owner. The calls are unrolled at compile time.
+  /// @par Examples
+  /// @code
+  /// class person {
+  /// public:
+  ///   property_<std::string> name;
+  ///   property_<int> age;
+  ///
+  ///   reflect_properties_(person, name, age);
+  /// };
+  ///
+  /// person p;
+  /// for_each_property_(p, [](auto descriptor, auto& property) {std::cout << descriptor.name << " = " << property << std::endl;});
+  /// @endcode
+  template <class owner_t, class function_t>
+  constexpr void for_each_property_(owner_t& owner, function_t&& function) {
+    std::apply([&](auto... descriptors) {(function(descriptors, descriptors.access(owner)), ...);}, properties_of_<std::remove_const_t<owner_t>>());
+  }
+}
+
+/// @brief Registers the properties of an owner class so that they can be visited at compile time.
+/// @par Library
+/// xtd.properties
+/// @ingroup keywords
+/// @remarks Use it once inside the owner class, after the properties, with the name of the class followed by the names of up to 64 property_ or member_property_ members.
+/// @par Examples
+/// @code
+/// class person {
+/// public:
+///   property_<std::string> name;
+///   property_<int, readonly_> age {get_ {return age_;}};
+///
+///   reflect_properties_(person, name, age);
+///
+/// private:
+///   int age_ = 42;
+/// };
+///
+/// static_assert(property_count_<person> == 2);
+/// @endcode
+#define reflect_properties_(owner, ...) \
+  static constexpr auto xtd_properties_reflect_() noexcept {return std::make_tuple(XTD_PROPERTIES_FOR_EACH_(XTD_PROPERTIES_DESCRIPTOR_, owner, __VA_ARGS__));} \
+  friend struct xtd::detail::reflection_access_
+
+/// @cond
+#define XTD_PROPERTIES_DESCRIPTOR_(owner, name) xtd::property_descriptor_<owner, decltype(owner::name), &owner::name> {#name}
+#define XTD_PROPERTIES_EXPAND_(x) x
+#define XTD_PROPERTIES_CONCAT_IMPL_(a, b) a##b
+#define XTD_PROPERTIES_CONCAT_(a, b) XTD_PROPERTIES_CONCAT_IMPL_(a, b)
+#define XTD_PROPERTIES_COUNT_N_(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, count, ...) count
+#define XTD_PROPERTIES_COUNT_(...) XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_COUNT_N_(__VA_ARGS__, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+#define XTD_PROPERTIES_FOR_EACH_1_(macro, owner, name) macro(owner, name)
+#define XTD_PROPERTIES_FOR_EACH_2_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_1_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_3_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_2_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_4_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_3_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_5_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_4_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_6_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_5_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_7_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_6_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_8_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_7_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_9_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_8_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_10_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_9_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_11_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_10_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_12_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_11_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_13_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_12_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_14_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_13_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_15_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_14_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_16_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_15_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_17_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_16_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_18_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_17_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_19_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_18_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_20_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_19_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_21_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_20_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_22_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_21_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_23_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_22_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_24_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_23_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_25_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_24_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_26_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_25_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_27_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_26_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_28_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_27_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_29_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_28_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_30_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_29_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_31_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_30_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_32_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_31_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_33_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_32_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_34_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_33_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_35_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_34_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_36_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_35_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_37_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_36_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_38_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_37_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_39_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_38_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_40_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_39_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_41_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_40_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_42_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_41_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_43_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_42_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_44_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_43_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_45_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_44_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_46_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_45_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_47_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_46_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_48_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_47_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_49_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_48_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_50_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_49_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_51_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_50_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_52_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_51_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_53_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_52_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_54_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_53_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_55_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_54_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_56_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_55_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_57_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_56_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_58_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_57_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_59_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_58_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_60_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_59_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_61_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_60_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_62_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_61_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_63_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_62_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_64_(macro, owner, name, ...) macro(owner, name), XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_FOR_EACH_63_(macro, owner, __VA_ARGS__))
+#define XTD_PROPERTIES_FOR_EACH_(macro, owner, ...) XTD_PROPERTIES_EXPAND_(XTD_PROPERTIES_CONCAT_(XTD_PROPERTIES_FOR_EACH_, XTD_PROPERTIES_CONCAT_(XTD_PROPERTIES_COUNT_(__VA_ARGS__), _))(macro, owner, __VA_ARGS__))
+/// @endcond
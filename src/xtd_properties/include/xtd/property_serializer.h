@@ -0,0 +1,409 @@
+/// @file
+/// @brief Contains serialize_, deserialize_, serialized_size_ functions and property_stream_writer_, property_stream_reader_ classes.
+#pragma once
+
+#include "observable_property.h"
+#include "property_reflection.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @cond
+  namespace detail {
+    template <class type_t>
+    struct is_string_ : std::false_type {};
+    template <class char_t, class traits_t, class allocator_t>
+    struct is_string_<std::basic_string<char_t, traits_t, allocator_t>> : std::true_type {};
+
+    template <class type_t>
+    struct is_vector_ : std::false_type {};
+    template <class type_t, class allocator_t>
+    struct is_vector_<std::vector<type_t, allocator_t>> : std::true_type {};
+
+    // The properties whose modify() gives the stored value itself, so that it can be decoded in place and keep its allocations.
+    template <class property_t>
+    struct is_decoded_in_place_ : std::false_type {};
+    template <class type_t>
+    struct is_decoded_in_place_<property_<type_t, readwrite_>> : std::true_type {};
+    template <class type_t>
+    struct is_decoded_in_place_<property_<type_t, observable_>> : std::true_type {};
+    template <class owner_t, class offset_t, class type_t, auto getter, auto setter>
+    struct is_decoded_in_place_<member_property_<owner_t, offset_t, type_t, getter, setter>> : std::true_type {};
+
+    // The trivially copyable types that are decoded one by one and checked, because not every byte pattern is one of their values.
+    template <class type_t>
+    constexpr bool is_checked_ = std::is_same<type_t, bool>::value || std::is_enum<type_t>::value;
+
+    template <class descriptor_t>
+    constexpr bool is_serialized_ = descriptor_t::can_read && descriptor_t::can_write;
+
+    struct size_output_ {
+      void put(const void*, std::size_t size) noexcept {position += size;}
+      bool good() const noexcept {return true;}
+
+      std::size_t position = 0;
+    };
+
+    struct buffer_output_ {
+      void put(const void* source, std::size_t size) noexcept {
+        if (!good() || capacity - position < size) {
+          failed = true;
+          return;
+        }
+        if (size) std::memcpy(data + position, source, size);
+        position += size;
+      }
+      bool good() const noexcept {return !failed;}
+
+      unsigned char* data;
+      std::size_t capacity;
+      std::size_t position = 0;
+      bool failed = false;
+    };
+
+    struct buffer_input_ {
+      bool get(void* target, std::size_t size) noexcept {
+        if (failed || capacity - position < size) return !(failed = true);
+        if (size) std::memcpy(target, data + position, size);
+        position += size;
+        return true;
+      }
+      std::size_t remaining() const noexcept {return capacity - position;}
+
+      static constexpr bool bounded = true;
+      const unsigned char* data;
+      std::size_t capacity;
+      std::size_t position = 0;
+      bool failed = false;
+    };
+
+    // The number of bytes the encoding of a value of type_t takes at least.
+    template <class type_t>
+    constexpr std::size_t min_encoded_size_() {
+      if constexpr (is_reflectable_<type_t>) {
+        auto size = std::size_t {0};
+        for_each_property_<type_t>([&](auto descriptor) {
+          using descriptor_type = decltype(descriptor);
+          if constexpr (is_serialized_<descriptor_type>) size += min_encoded_size_<typename descriptor_type::value_type>();
+        });
+        return size;
+      } else if constexpr (std::is_trivially_copyable<type_t>::value) return sizeof(type_t);
+      else return 1;
+    }
+
+    // Encodes the properties of reflectable objects : values of trivially copyable types as their bytes in native byte order, strings and vectors as a LEB128 length followed by their items (copied at once when trivially copyable), and values of reflectable types as their properties.
+    template <class output_t>
+    struct encoder_ {
+      void length(std::size_t value) {
+        unsigned char bytes[10];
+        auto count = std::size_t {0};
+        do {
+          bytes[count++] = static_cast<unsigned char>((value & 0x7f) | (value > 0x7f ? 0x80 : 0));
+          value >>= 7;
+        } while (value);
+        output.put(bytes, count);
+      }
+
+      template <class type_t>
+      void value(const type_t& value) {
+        if constexpr (is_reflectable_<type_t>) object(value);
+        else if constexpr (std::is_trivially_copyable<type_t>::value) output.put(&value, sizeof(type_t));
+        else if constexpr (is_string_<type_t>::value) {
+          length(value.size());
+          output.put(value.data(), value.size() * sizeof(typename type_t::value_type));
+        } else if constexpr (is_vector_<type_t>::value && std::is_trivially_copyable<typename type_t::value_type>::value) {
+          length(value.size());
+          output.put(value.data(), value.size() * sizeof(typename type_t::value_type));
+        } else if constexpr (is_vector_<type_t>::value) {
+          length(value.size());
+          for (const auto& item : value)
+            this->value(item);
+        } else static_assert(std::is_void<type_t>::value, "The type of a serialized property_ must be trivially copyable, a std::basic_string, a std::vector or a class with reflect_properties_.");
+      }
+
+      template <class owner_t>
+      void object(const owner_t& owner) {
+        for_each_property_<owner_t>([&](auto descriptor) {
+          using descriptor_type = decltype(descriptor);
+          if constexpr (is_serialized_<descriptor_type>) {
+            const typename descriptor_type::value_type& item = descriptor.get(owner);
+            value(item);
+          }
+        });
+      }
+
+      output_t& output;
+    };
+
+    template <class input_t>
+    struct decoder_ {
+      bool length(std::size_t& value) {
+        value = 0;
+        for (auto shift = 0u; shift < 64; shift += 7) {
+          unsigned char byte = 0;
+          if (!input.get(&byte, 1)) return false;
+          value |= static_cast<std::size_t>(byte & 0x7f) << shift;
+          if ((byte & 0x80) == 0) return true;
+        }
+        return false;
+      }
+
+      // Whether the input can still hold count items that take at least size bytes each. The end of a stream is unknown : there, grow() bounds the allocations instead.
+      bool can_hold(std::size_t count, std::size_t size) const noexcept {
+        if constexpr (input_t::bounded) return count <= input.remaining() / size;
+        else return true;
+      }
+
+      // The number of items to decode before growing again a container that holds size of count items : all of them from a buffer, twice as many from a stream, so that a corrupted length fails at the end of the source instead of allocating count items.
+      static std::size_t grow(std::size_t size, std::size_t count) noexcept {
+        if constexpr (input_t::bounded) return count;
+        else return size + std::min(count - size, std::max(size, std::size_t {64}));
+      }
+
+      template <class type_t>
+      bool items(type_t& value) {
+        using item_type = typename type_t::value_type;
+        auto count = std::size_t {0};
+        if (!length(count) || !can_hold(count, sizeof(item_type))) return false;
+        for (auto size = std::size_t {0}; size < count;) {
+          auto next = grow(size, count);
+          value.resize(next);
+          if (!input.get(&value[size], (next - size) * sizeof(item_type))) return false;
+          size = next;
+        }
+        value.resize(count);
+        return true;
+      }
+
+      // Accepts only the bytes of false and true.
+      bool boolean(bool& value) {
+        unsigned char bytes[sizeof(bool)];
+        if (!input.get(bytes, sizeof(bool))) return false;
+        for (auto candidate : {false, true})
+          if (std::memcmp(bytes, &candidate, sizeof(bool)) == 0) {
+            value = candidate;
+            return true;
+          }
+        return false;
+      }
+
+      template <class type_t>
+      bool value(type_t& value) {
+        if constexpr (is_reflectable_<type_t>) return object(value);
+        else if constexpr (std::is_same<type_t, bool>::value) return boolean(value);
+        else if constexpr (std::is_enum<type_t>::value) {
+          auto underlying = std::underlying_type_t<type_t> {};
+          if (!this->value(underlying)) return false;
+          value = static_cast<type_t>(underlying);
+          return true;
+        } else if constexpr (std::is_trivially_copyable<type_t>::value) return input.get(&value, sizeof(type_t));
+        else if constexpr (is_string_<type_t>::value) return items(value);
+        else if constexpr (is_vector_<type_t>::value && std::is_trivially_copyable<typename type_t::value_type>::value && !is_checked_<typename type_t::value_type>) return items(value);
+        else if constexpr (is_vector_<type_t>::value) {
+          using item_type = typename type_t::value_type;
+          static_assert(min_encoded_size_<item_type>() != 0, "The items of a serialized std::vector must have at least one serialized property.");
+          auto count = std::size_t {0};
+          if (!length(count) || !can_hold(count, min_encoded_size_<item_type>())) return false;
+          for (auto size = std::size_t {0}; size < count;) {
+            auto next = grow(size, count);
+            if (value.size() < next) value.resize(next);
+            for (; size < next; ++size)
+              if (!this->value(value[size])) return false;
+          }
+          value.resize(count);
+          return true;
+        } else static_assert(std::is_void<type_t>::value, "The type of a serialized property_ must be trivially copyable, a std::basic_string, a std::vector or a class with reflect_properties_.");
+      }
+
+      template <class owner_t>
+      bool object(owner_t& owner) {
+        auto succeeded = true;
+        for_each_property_<owner_t>([&](auto descriptor) {
+          using descriptor_type = decltype(descriptor);
+          using value_type = typename descriptor_type::value_type;
+          if constexpr (is_serialized_<descriptor_type>) {
+            if (!succeeded) return;
+            auto& property = descriptor.access(owner);
+            if constexpr (is_decoded_in_place_<typename descriptor_type::property_type>::value) property.modify([&](value_type& item) {succeeded = value(item);});
+            else {
+              value_type item {};
+              if ((succeeded = value(item))) property = std::move(item);
+            }
+          }
+        });
+        return succeeded;
+      }
+
+      input_t& input;
+    };
+  }
+  /// @endcond
+
+  /// @brief Gets the number of bytes serialize_ writes for owner.
+  template <class owner_t>
+  std::size_t serialized_size_(const owner_t& owner) {
+    detail::size_output_ output;
+    detail::encoder_<detail::size_output_> {output}.object(owner);
+    return output.position;
+  }
+
+  /// @brief Writes the read write properties of owner, a class that uses #reflect_properties_, to buffer in a compact binary format.
+  /// @return The number of bytes written, or 0 if size is too small.
+  /// @remarks The properties are written in the order of #reflect_properties_ ; read only and write only properties are skipped. Trivially copyable values are copied with memcpy in native byte order, strings and vectors are prefixed with their LEB128 length, and properties whose type uses #reflect_properties_ are written recursively. The format is meant for snapshots and transfers between builds of the same class on the same architecture.
+  /// @par Examples
+  /// @code
+  /// class person {
+  /// public:
+  ///   property_<std::string> name;
+  ///   property_<int> age;
+  ///   reflect_properties_(person, name, age);
+  /// };
+  ///
+  /// person p, copy;
+  /// std::vector<unsigned char> buffer(serialized_size_(p));
+  /// serialize_(p, buffer.data(), buffer.size());
+  /// deserialize_(copy, buffer.data(), buffer.size());
+  /// @endcode
+  template <class owner_t>
+  std::size_t serialize_(const owner_t& owner, void* buffer, std::size_t size) {
+    detail::buffer_output_ output {static_cast<unsigned char*>(buffer), size};
+    detail::encoder_<detail::buffer_output_> {output}.object(owner);
+    return output.good() ? output.position : 0;
+  }
+
+  /// @brief Reads the read write properties of owner from buffer, written by serialize_ or property_stream_writer_.
+  /// @return The number of bytes read, or 0 if buffer is truncated or corrupted ; owner may then be partially updated.
+  /// @remarks The values are assigned through the setters. The values of auto properties, observable_ properties and member_property_ members are decoded in place, so strings and vectors reuse their allocations.
+  /// @remarks A bool that is neither false nor true makes the buffer corrupted. An enum is decoded through its underlying type : any value of it is valid for a scoped enum or an enum with a fixed underlying type, but an unscoped enum without one only holds the values in the range of its enumerators. The members of other trivially copyable types are copied as they are, without check.
+  template <class owner_t>
+  std::size_t deserialize_(owner_t& owner, const void* buffer, std::size_t size) {
+    detail::buffer_input_ input {static_cast<const unsigned char*>(buffer), size};
+    return detail::decoder_<detail::buffer_input_> {input}.object(owner) ? input.position : 0;
+  }
+
+  /// @brief A property_stream_writer_ serializes objects one after the other through a caller supplied buffer, handing the buffer to a sink each time it is full.
+  /// @remarks The format of each object is the one of serialize_ ; an object larger than the buffer is written in several pieces. Large strings and vectors bypass the buffer and go to the sink directly. The destructor flushes the buffer.
+  /// @par Examples
+  /// @code
+  /// std::ofstream file("persons.bin", std::ios::binary);
+  /// unsigned char buffer[4096];
+  /// property_stream_writer_ writer(buffer, sizeof(buffer), [&](const void* data, std::size_t size) {return bool(file.write(static_cast<const char*>(data), size));});
+  /// for (const auto& p : persons) writer.write(p);
+  /// @endcode
+  class property_stream_writer_ {
+  public:
+    /// @brief The type of the sink : it is called with the bytes to write and returns false if it fails.
+    using sink_type = detail::accessor_<bool(const void*, std::size_t)>;
+
+    /// @brief Initializes a new writer that fills buffer of size bytes and empties it into sink.
+    property_stream_writer_(void* buffer, std::size_t size, sink_type sink) : data(static_cast<unsigned char*>(buffer)), capacity(size), sink(std::move(sink)) {}
+
+    /// @cond
+    property_stream_writer_(const property_stream_writer_&) = delete;
+    property_stream_writer_& operator=(const property_stream_writer_&) = delete;
+    ~property_stream_writer_() {flush();}
+    /// @endcond
+
+    /// @brief Writes the read write properties of owner.
+    /// @return false if the sink failed.
+    template <class owner_t>
+    bool write(const owner_t& owner) {
+      detail::encoder_<property_stream_writer_> {*this}.object(owner);
+      return good();
+    }
+
+    /// @brief Hands the buffered bytes to the sink.
+    /// @return false if the sink failed.
+    bool flush() {
+      if (position && !failed) failed = !sink(data, position);
+      position = 0;
+      return good();
+    }
+
+    /// @brief Gets whether the sink has not failed.
+    bool good() const noexcept {return !failed;}
+
+    /// @cond
+    void put(const void* source, std::size_t size) {
+      if (failed) return;
+      if (capacity - position < size) {
+        flush();
+        if (size >= capacity) {
+          failed = failed || !sink(source, size);
+          return;
+        }
+      }
+      if (size) std::memcpy(data + position, source, size);
+      position += size;
+    }
+    /// @endcond
+
+  private:
+    unsigned char* data;
+    std::size_t capacity;
+    std::size_t position = 0;
+    sink_type sink;
+    bool failed = false;
+  };
+
+  /// @brief A property_stream_reader_ deserializes objects written by a property_stream_writer_, refilling a caller supplied buffer from a source.
+  /// @remarks Large strings and vectors are read from the source directly into their storage. A corrupted length is detected at the end of the source : strings and vectors grow with the bytes actually read, so that it never allocates much more than the source holds.
+  class property_stream_reader_ {
+  public:
+    /// @brief The type of the source : it is called with a buffer and its size, and returns the number of bytes it read into it, 0 at the end.
+    using source_type = detail::accessor_<std::size_t(void*, std::size_t)>;
+
+    /// @brief Initializes a new reader that refills buffer of size bytes from source.
+    property_stream_reader_(void* buffer, std::size_t size, source_type source) : data(static_cast<unsigned char*>(buffer)), capacity(size), source(std::move(source)) {}
+
+    /// @cond
+    property_stream_reader_(const property_stream_reader_&) = delete;
+    property_stream_reader_& operator=(const property_stream_reader_&) = delete;
+    /// @endcond
+
+    /// @brief Reads the next object into owner.
+    /// @return false at the end of the source or if the source is truncated or corrupted.
+    template <class owner_t>
+    bool read(owner_t& owner) {return !failed && fill() && detail::decoder_<property_stream_reader_> {*this}.object(owner);}
+
+    /// @cond
+    bool get(void* target, std::size_t size) {
+      auto output = static_cast<unsigned char*>(target);
+      while (size && !failed) {
+        if (position == count && size >= capacity) {
+          auto read = source(output, size);
+          failed = read == 0;
+          output += read;
+          size -= read;
+          continue;
+        }
+        if (!fill()) return !(failed = true);
+        auto chunk = std::min(size, count - position);
+        std::memcpy(output, data + position, chunk);
+        position += chunk;
+        output += chunk;
+        size -= chunk;
+      }
+      return !failed;
+    }
+    static constexpr bool bounded = false;
+    /// @endcond
+
+  private:
+    bool fill() {
+      if (position != count) return true;
+      position = 0;
+      count = source(data, capacity);
+      return count != 0;
+    }
+
+    unsigned char* data;
+    std::size_t capacity;
+    std::size_t position = 0;
+    std::size_t count = 0;
+    source_type source;
+    bool failed = false;
+  };
+}
@@ -0,0 +1,195 @@
+/// @file
+/// @brief Contains snapshot_ attribute, property_<type_t, snapshot_> and property_snapshot_ classes.
+#pragma once
+
+#include "properties.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+// The property_ keyword is suspended while this header specializes the property_ class.
+#pragma push_macro("property_")
+#undef property_
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief snapshot_ struct represent a property_ read write attribute for values read from many threads and seldom written.
+  struct snapshot_ : public readwrite_ {};
+
+  /// @cond
+  namespace detail {
+    template <class type_t>
+    struct snapshot_node_ {
+      template <class... args_t>
+      explicit snapshot_node_(args_t&&... args) : value(std::forward<args_t>(args)...) {}
+
+      static void release(snapshot_node_* node) noexcept {
+        if (node && node->references.fetch_sub(1, std::memory_order_acq_rel) == 1) delete node;
+      }
+
+      std::atomic<std::size_t> references {1};
+      type_t value;
+    };
+  }
+  /// @endcond
+
+  /// @brief A property_snapshot_ is a handle to an immutable value published by a snapshot_ property_. The value stays alive as long as a handle refers to it, even if the property_ has been written since.
+  template <class type_t>
+  class property_snapshot_ {
+    using node_type = detail::snapshot_node_<type_t>;
+
+  public:
+    /// @brief This method retrieves the value of the snapshot.
+    const type_t& get() const noexcept {return node->value;}
+
+    /// @cond
+    property_snapshot_(const property_snapshot_& other) noexcept : node(other.node) {node->references.fetch_add(1, std::memory_order_relaxed);}
+    property_snapshot_& operator=(const property_snapshot_& other) noexcept {
+      property_snapshot_ copy(other);
+      std::swap(node, copy.node);
+      return *this;
+    }
+    ~property_snapshot_() {node_type::release(node);}
+
+    const type_t& operator*() const noexcept {return node->value;}
+    const type_t* operator->() const noexcept {return &node->value;}
+    operator const type_t&() const & noexcept {return node->value;}
+    operator type_t() && {return node->value;}
+    bool operator==(const type_t& value) const {return node->value == value;}
+    bool operator!=(const type_t& value) const {return node->value != value;}
+
+    friend std::ostream& operator<<(std::ostream& os, const property_snapshot_& s) {return os << s.get();}
+    /// @endcond
+
+  private:
+    template <class, class, class, class> friend class property_;
+    explicit property_snapshot_(node_type* node) noexcept : node(node) {}
+
+    node_type* node;
+  };
+
+  /// @brief A snapshot_ property_ is a read write property_ whose value can be read from many threads while another thread writes it, without serializing the readers.
+  /// @remarks Each write publishes a new immutable copy of the value ; get() returns a property_snapshot_ handle to the current copy. Readers never take a lock nor wait for a writer : they register in one of two reader counters, take a reference on the current copy and leave. A writer publishes the new copy, flips the counters and waits for the readers still registered on the old counter before releasing its own reference on the old copy, which is deleted once the last handle to it is destroyed.
+  /// @remarks Writes are serialized by a mutex and allocate a copy ; modify() and the compound operators copy the current value, change the copy and publish it. Use it for configuration or lookup tables read far more often than written.
+  /// @par Examples
+  /// @code
+  /// class service {
+  /// public:
+  ///   property_<std::vector<std::string>, snapshot_> routes;
+  /// };
+  ///
+  /// service s;
+  /// // reader threads :
+  /// auto routes = s.routes(); // Stays valid while another thread writes s.routes.
+  /// for (const auto& route : *routes) std::cout << route << std::endl;
+  /// // writer thread :
+  /// s.routes.modify([](std::vector<std::string>& routes) {routes.push_back("/status");});
+  /// @endcode
+  template <class type_t>
+  class property_<type_t, snapshot_> : public snapshot_ {
+    using node_type = detail::snapshot_node_<type_t>;
+
+  public:
+    /// @brief This method is an accessor method that retrieves a snapshot of the value of the property_.
+    property_snapshot_<type_t> get() const noexcept {return acquire();}
+
+    /// @brief This operator is an accessor operator that retrieves a snapshot of the value of the property_.
+    property_snapshot_<type_t> operator()() const noexcept {return acquire();}
+
+    /// @brief This method is an accessor method that publishes a copy of value.
+    void set(const type_t& value) {publish(new node_type(value));}
+    /// @brief This method is an accessor method that publishes value.
+    void set(type_t&& value) {publish(new node_type(std::move(value)));}
+
+    /// @brief This method is an accessor method that publishes a value constructed from args.
+    template <class... args_t>
+    void emplace(args_t&&... args) {publish(new node_type(std::forward<args_t>(args)...));}
+
+    /// @brief This method is an accessor method that lets function modify a copy of the current value and publishes it. Concurrent calls to modify() do not lose updates.
+    template <class function_t>
+    void modify(function_t&& function) {
+      std::lock_guard<std::mutex> lock(writer);
+      auto node = new node_type(current.load(std::memory_order_relaxed)->value);
+      try {
+        function(node->value);
+      } catch (...) {
+        delete node;
+        throw;
+      }
+      replace(node);
+    }
+
+    /// @brief This operator is an accessor operator that publishes a copy of value.
+    void operator()(const type_t& value) {set(value);}
+    /// @brief This operator is an accessor operator that publishes value.
+    void operator()(type_t&& value) {set(std::move(value));}
+
+    /// @cond
+    property_() : current(new node_type()) {}
+    property_(const type_t& value) : current(new node_type(value)) {}
+    property_(type_t&& value) : current(new node_type(std::move(value))) {}
+    property_(const property_& property) : current(new node_type(*property.get())) {}
+    ~property_() {node_type::release(current.load(std::memory_order_relaxed));}
+
+    property_& operator=(const property_& other) {set(*other.get()); return *this;}
+    bool operator==(const type_t& value) const {return *get() == value;}
+    bool operator!=(const type_t& value) const {return *get() != value;}
+
+    property_& operator=(const type_t& value) {set(value); return *this;}
+    property_& operator=(type_t&& value) {set(std::move(value)); return *this;}
+    void operator+=(const type_t& value) {modify(detail::compound_<detail::add_, type_t> {value});}
+    void operator-=(const type_t& value) {modify(detail::compound_<detail::subtract_, type_t> {value});}
+    void operator*=(const type_t& value) {modify(detail::compound_<detail::multiply_, type_t> {value});}
+    void operator /=(const type_t& value) {modify(detail::compound_<detail::divide_, type_t> {value});}
+    void operator %=(const type_t& value) {modify(detail::compound_<detail::modulus_, type_t> {value});}
+    void operator &=(const type_t& value) {modify(detail::compound_<detail::bit_and_, type_t> {value});}
+    void operator |=(const type_t& value) {modify(detail::compound_<detail::bit_or_, type_t> {value});}
+    void operator ^=(const type_t& value) {modify(detail::compound_<detail::bit_xor_, type_t> {value});}
+    void operator<<=(const type_t& value) {modify(detail::compound_<detail::left_shift_, type_t> {value});}
+    void operator>>=(const type_t& value) {modify(detail::compound_<detail::right_shift_, type_t> {value});}
+
+    friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os << *p();}
+    /// @endcond
+
+  private:
+    // A reader registers on the counter of the current epoch and checks that no writer flipped the epoch in between : a writer that replaces the node it then loads will wait for it on this counter.
+    property_snapshot_<type_t> acquire() const noexcept {
+      auto epoch_before = epoch.load();
+      readers[epoch_before & 1].fetch_add(1);
+      while (epoch.load() != epoch_before) {
+        readers[epoch_before & 1].fetch_sub(1);
+        epoch_before = epoch.load();
+        readers[epoch_before & 1].fetch_add(1);
+      }
+      auto node = current.load();
+      node->references.fetch_add(1, std::memory_order_relaxed);
+      readers[epoch_before & 1].fetch_sub(1);
+      return property_snapshot_<type_t>(node);
+    }
+
+    void publish(node_type* node) {
+      std::lock_guard<std::mutex> lock(writer);
+      replace(node);
+    }
+
+    // Must be called with the writer mutex held.
+    void replace(node_type* node) noexcept {
+      auto old_node = current.exchange(node);
+      auto old_epoch = epoch.fetch_add(1);
+      while (readers[old_epoch & 1].load()) std::this_thread::yield();
+      node_type::release(old_node);
+    }
+
+    std::atomic<node_type*> current;
+    mutable std::atomic<std::size_t> readers[2] {};
+    std::atomic<std::size_t> epoch {0};
+    std::mutex writer;
+  };
+}
+
+#pragma pop_macro("property_")
+
+/// @brief #snapshot_ represent a property_ read write attribute for values read from many threads and seldom written.
+/// @ingroup keywords
+#define snapshot_ \
+  xtd::snapshot_
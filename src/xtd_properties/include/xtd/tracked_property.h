@@ -0,0 +1,368 @@
+/// @file
+/// @brief Contains tracked_ attribute, property_<type_t, tracked_>, property_dirty_set_ and property_dirty_mask_ classes, and for_each_dirty_property_, serialize_delta_, deserialize_delta_ functions.
+#pragma once
+
+#include "property_serializer.h"
+#include <atomic>
+#include <cstdint>
+
+// The property_ keyword is suspended while this header specializes the property_ class.
+#pragma push_macro("property_")
+#undef property_
+
+/// @brief The xtd namespace contains all fundamental classes to access Hardware, Os, System, and more.
+namespace xtd {
+  /// @brief tracked_ struct represent a property_ read write attribute for an auto-property whose writes mark it dirty in a property_dirty_set_.
+  struct tracked_ : public readwrite_ {};
+
+  template <std::size_t bit_count>
+  class property_dirty_set_;
+
+  /// @cond
+  namespace detail {
+    template <class property_t>
+    struct is_tracked_ : std::false_type {};
+    template <class type_t>
+    struct is_tracked_<property_<type_t, tracked_>> : std::true_type {};
+
+    // Gives the delta functions the value of a tracked_ property_, to decode it in place without marking it dirty.
+    struct tracked_access_ {
+      template <class type_t>
+      static type_t& value(property_<type_t, tracked_>& property) noexcept {return property.value;}
+    };
+  }
+  /// @endcond
+
+  /// @brief A property_dirty_mask_ is a copy of the bits of a property_dirty_set_, as returned by property_dirty_set_::take().
+  template <std::size_t bit_count>
+  class property_dirty_mask_ {
+  public:
+    /// @brief Gets whether the bit index is set.
+    bool test(std::size_t index) const noexcept {return index < bit_count && ((words[index / 64] >> (index % 64)) & 1) != 0;}
+
+    /// @brief Sets the bit index.
+    void set(std::size_t index) noexcept {if (index < bit_count) words[index / 64] |= std::uint64_t {1} << (index % 64);}
+
+    /// @brief Gets whether a bit is set.
+    bool any() const noexcept {
+      for (auto word : words)
+        if (word) return true;
+      return false;
+    }
+
+    /// @brief Gets the number of bits set.
+    std::size_t count() const noexcept {
+      auto count = std::size_t {0};
+      for (auto word : words)
+        for (; word; word &= word - 1)
+          ++count;
+      return count;
+    }
+
+  private:
+    friend class property_dirty_set_<bit_count>;
+
+    std::uint64_t words[(bit_count + 63) / 64] {};
+  };
+
+  /// @brief A property_dirty_set_ is the compact bitset of an owner class in which its tracked_ properties mark themselves dirty when they are written.
+  /// @remarks Each tracked_ property_ built with the set takes the next of its bit_count bits, in the order of construction ; a property_ built when all the bits are taken is not tracked. A write is a single atomic or on the word of its bit.
+  /// @remarks take() copies the bits and clears them, one atomic exchange per word : a bit set while it runs is either in the mask returned or still in the set, so no write is lost between two synchronizations. The bits can be set and taken from several threads ; the values of the properties are not synchronized by the set.
+  /// @par Examples
+  /// @code
+  /// class player {
+  /// public:
+  ///   property_dirty_set_<> changes;
+  ///   property_<std::string, tracked_> name {changes};
+  ///   property_<int, tracked_> score {changes};
+  ///
+  ///   reflect_properties_(player, name, score);
+  /// };
+  ///
+  /// player p;
+  /// p.score += 10;
+  /// auto dirty = p.changes.take(); // Only score is dirty, and p.changes is clear.
+  /// @endcode
+  template <std::size_t bit_count = 64>
+  class property_dirty_set_ {
+  public:
+    /// @brief The type of the copy of the bits returned by take().
+    using mask_type = property_dirty_mask_<bit_count>;
+
+    /// @cond
+    property_dirty_set_() noexcept = default;
+    property_dirty_set_(const property_dirty_set_&) = delete;
+    property_dirty_set_& operator=(const property_dirty_set_&) = delete;
+    /// @endcond
+
+    /// @brief Gets the number of bits of the set, the maximum number of tracked_ properties.
+    static constexpr std::size_t capacity() noexcept {return bit_count;}
+
+    /// @brief Gets the number of tracked_ properties built with the set.
+    std::size_t size() const noexcept {return attached;}
+
+    /// @brief Gets whether a property_ is dirty.
+    bool any() const noexcept {
+      for (auto& word : words)
+        if (word.load(std::memory_order_relaxed)) return true;
+      return false;
+    }
+
+    /// @brief Gets the number of dirty properties.
+    std::size_t count() const noexcept {return snapshot().count();}
+
+    /// @brief Gets whether the property_ of the bit index is dirty.
+    bool test(std::size_t index) const noexcept {return index < bit_count && ((words[index / 64].load(std::memory_order_relaxed) >> (index % 64)) & 1) != 0;}
+
+    /// @brief Marks the property_ of the bit index dirty.
+    void mark(std::size_t index) noexcept {if (index < bit_count) words[index / 64].fetch_or(std::uint64_t {1} << (index % 64), std::memory_order_release);}
+
+    /// @brief Marks dirty the properties of the bits set in mask, for example to send again a delta that could not be sent.
+    void mark(const mask_type& mask) noexcept {
+      for (auto index = std::size_t {0}; index < word_count; ++index)
+        if (mask.words[index]) words[index].fetch_or(mask.words[index], std::memory_order_release);
+    }
+
+    /// @brief Marks dirty all the tracked_ properties, for example before the first synchronization.
+    void mark_all() noexcept {
+      for (auto index = std::size_t {0}; index < attached; ++index)
+        mark(index);
+    }
+
+    /// @brief Gets a copy of the bits without clearing them.
+    mask_type snapshot() const noexcept {
+      mask_type mask;
+      for (auto index = std::size_t {0}; index < word_count; ++index)
+        mask.words[index] = words[index].load(std::memory_order_acquire);
+      return mask;
+    }
+
+    /// @brief Gets a copy of the bits and clears them atomically.
+    mask_type take() noexcept {
+      mask_type mask;
+      for (auto index = std::size_t {0}; index < word_count; ++index)
+        mask.words[index] = words[index].exchange(0, std::memory_order_acq_rel);
+      return mask;
+    }
+
+    /// @brief Clears all the bits.
+    void clear() noexcept {
+      for (auto& word : words)
+        word.store(0, std::memory_order_release);
+    }
+
+  private:
+    template <class, class, class, class> friend class property_;
+
+    static constexpr std::size_t word_count = (bit_count + 63) / 64;
+
+    // Gives the next bit to a tracked_ property_ ; nullptr when all the bits are taken.
+    std::atomic<std::uint64_t>* attach(std::size_t& index) noexcept {
+      if (attached == bit_count) return nullptr;
+      index = attached++;
+      return &words[index / 64];
+    }
+
+    std::atomic<std::uint64_t> words[word_count] {};
+    std::size_t attached = 0;
+  };
+
+  /// @brief A tracked_ property_ is a read write auto-property that marks its bit dirty in the property_dirty_set_ of its owner each time it is written.
+  /// @remarks set(), emplace(), modify(), operator= and the compound operators mark the property_ dirty, even if the value does not change, so a write costs one atomic or and no comparison. A property_ built without a set is not tracked.
+  /// @remarks The property_ cannot be copy constructed, since the copy would mark the bit of the original owner : give the owner class its own copy constructor. Declare the set before the properties so that it is built first.
+  /// @par Examples
+  /// @code
+  /// class sensor {
+  /// public:
+  ///   property_dirty_set_<> changes;
+  ///   property_<double, tracked_> temperature {changes};
+  ///   property_<double, tracked_> humidity {changes, 50.0};
+  /// };
+  ///
+  /// sensor s;
+  /// s.temperature = 21.5;
+  /// bool dirty = s.temperature.is_dirty(); // true
+  /// @endcode
+  template <class type_t>
+  class property_<type_t, tracked_> : public tracked_ {
+  public:
+    /// @brief This method is an accessor method that retrieves the value of the property_.
+    const type_t& get() const noexcept {return value;}
+
+    /// @brief This operator is an accessor operator that retrieves the value of the property_.
+    const type_t& operator()() const noexcept {return value;}
+
+    /// @brief This method is an accessor method that assigns the value of the property_ and marks it dirty.
+    const type_t& set(const type_t& value) {
+      this->value = value;
+      mark();
+      return this->value;
+    }
+    /// @brief This method is an accessor method that moves the value into the property_ and marks it dirty.
+    const type_t& set(type_t&& value) {
+      this->value = std::move(value);
+      mark();
+      return this->value;
+    }
+
+    /// @brief This method is an accessor method that assigns a value constructed from args and marks the property_ dirty.
+    template <class... args_t>
+    const type_t& emplace(args_t&&... args) {return set(type_t(std::forward<args_t>(args)...));}
+
+    /// @brief This method is an accessor method that lets function modify the value of the property_ in place, then marks it dirty.
+    template <class function_t>
+    const type_t& modify(function_t&& function) {
+      function(value);
+      mark();
+      return value;
+    }
+
+    /// @brief This operator is an accessor operator that assigns the value of the property_ and marks it dirty.
+    const type_t& operator()(const type_t& value) {return set(value);}
+    /// @brief This operator is an accessor operator that moves the value into the property_ and marks it dirty.
+    const type_t& operator()(type_t&& value) {return set(std::move(value));}
+
+    /// @brief Gets whether the property_ has a bit in a property_dirty_set_.
+    bool is_tracked() const noexcept {return word != nullptr;}
+
+    /// @brief Gets whether the property_ has been written since its bit was last cleared.
+    bool is_dirty() const noexcept {return word && ((word->load(std::memory_order_relaxed) >> (bit % 64)) & 1) != 0;}
+
+    /// @brief Gets the index of the bit of the property_ in its property_dirty_set_.
+    std::size_t index() const noexcept {return bit;}
+
+    /// @cond
+    property_() : value() {}
+    property_(const type_t& value) : value(value) {}
+    property_(type_t&& value) : value(std::move(value)) {}
+    template <std::size_t bit_count>
+    property_(property_dirty_set_<bit_count>& dirty) : value(), word(dirty.attach(bit)) {}
+    template <std::size_t bit_count>
+    property_(property_dirty_set_<bit_count>& dirty, const type_t& value) : value(value), word(dirty.attach(bit)) {}
+    template <std::size_t bit_count>
+    property_(property_dirty_set_<bit_count>& dirty, type_t&& value) : value(std::move(value)), word(dirty.attach(bit)) {}
+    property_(const property_&) = delete;
+
+    operator const type_t&() const noexcept {return value;}
+    property_& operator=(const property_& other) {set(other.value); return *this;}
+    bool operator==(const type_t& value) const {return this->value == value;}
+    bool operator!=(const type_t& value) const {return this->value != value;}
+
+    property_& operator=(const type_t& value) {set(value); return *this;}
+    property_& operator=(type_t&& value) {set(std::move(value)); return *this;}
+    void operator+=(const type_t& value) {modify(detail::compound_<detail::add_, type_t> {value});}
+    void operator-=(const type_t& value) {modify(detail::compound_<detail::subtract_, type_t> {value});}
+    void operator*=(const type_t& value) {modify(detail::compound_<detail::multiply_, type_t> {value});}
+    void operator /=(const type_t& value) {modify(detail::compound_<detail::divide_, type_t> {value});}
+    void operator %=(const type_t& value) {modify(detail::compound_<detail::modulus_, type_t> {value});}
+    void operator &=(const type_t& value) {modify(detail::compound_<detail::bit_and_, type_t> {value});}
+    void operator |=(const type_t& value) {modify(detail::compound_<detail::bit_or_, type_t> {value});}
+    void operator ^=(const type_t& value) {modify(detail::compound_<detail::bit_xor_, type_t> {value});}
+    void operator<<=(const type_t& value) {modify(detail::compound_<detail::left_shift_, type_t> {value});}
+    void operator>>=(const type_t& value) {modify(detail::compound_<detail::right_shift_, type_t> {value});}
+
+    friend std::ostream& operator<<(std::ostream& os, const property_& p) {return os <<  p();}
+    /// @endcond
+
+  private:
+    friend struct detail::tracked_access_;
+
+    void mark() noexcept {if (word) word->fetch_or(std::uint64_t {1} << (bit % 64), std::memory_order_release);}
+
+    type_t value;
+    std::size_t bit = 0;
+    std::atomic<std::uint64_t>* word = nullptr;
+  };
+
+  /// @brief Calls function with the property_descriptor_ and the property_ of each tracked_ property of owner whose bit is set in mask, in the order of #reflect_properties_. The tests are unrolled at compile time.
+  /// @par Examples
+  /// @code
+  /// auto dirty = p.changes.take();
+  /// for_each_dirty_property_(p, dirty, [](auto descriptor, auto& property) {std::cout << descriptor.name << " = " << property << std::endl;});
+  /// @endcode
+  template <class owner_t, class mask_t, class function_t>
+  void for_each_dirty_property_(owner_t& owner, const mask_t& mask, function_t&& function) {
+    for_each_property_(owner, [&](auto descriptor, auto& property) {
+      if constexpr (detail::is_tracked_<typename decltype(descriptor)::property_type>::value) {
+        if (property.is_tracked() && mask.test(property.index())) function(descriptor, property);
+      }
+    });
+  }
+
+  /// @cond
+  namespace detail {
+    // A delta is the LEB128 number of properties, then for each property its LEB128 index in #reflect_properties_ followed by its value in the format of serialize_.
+    template <class output_t, class owner_t, class mask_t>
+    void encode_delta_(output_t& output, const owner_t& owner, const mask_t& mask) {
+      encoder_<output_t> encoder {output};
+      auto count = std::size_t {0};
+      for_each_dirty_property_(owner, mask, [&](auto, auto&) {++count;});
+      encoder.length(count);
+      auto position = std::size_t {0};
+      for_each_property_(owner, [&](auto descriptor, auto& property) {
+        if constexpr (is_tracked_<typename decltype(descriptor)::property_type>::value) {
+          if (property.is_tracked() && mask.test(property.index())) {
+            encoder.length(position);
+            encoder.value(property.get());
+          }
+        }
+        ++position;
+      });
+    }
+  }
+  /// @endcond
+
+  /// @brief Gets the number of bytes serialize_delta_ writes for the properties of owner whose bit is set in mask.
+  template <class owner_t, class mask_t>
+  std::size_t serialized_delta_size_(const owner_t& owner, const mask_t& mask) {
+    detail::size_output_ output;
+    detail::encode_delta_(output, owner, mask);
+    return output.position;
+  }
+
+  /// @brief Writes to buffer the index and the value of each tracked_ property of owner whose bit is set in mask, usually the mask returned by property_dirty_set_::take().
+  /// @return The number of bytes written, or 0 if size is too small.
+  /// @remarks The values are written in the format of serialize_, each one preceded by the LEB128 index of its property_ in #reflect_properties_ ; the delta starts with the number of properties. A delta with one small property_ is a few bytes, whatever the number of properties of owner.
+  /// @par Examples
+  /// @code
+  /// auto dirty = p.changes.take();
+  /// std::vector<unsigned char> buffer(serialized_delta_size_(p, dirty));
+  /// if (serialize_delta_(p, dirty, buffer.data(), buffer.size()) == 0 || !send(buffer)) p.changes.mark(dirty);
+  /// @endcode
+  template <class owner_t, class mask_t>
+  std::size_t serialize_delta_(const owner_t& owner, const mask_t& mask, void* buffer, std::size_t size) {
+    detail::buffer_output_ output {static_cast<unsigned char*>(buffer), size};
+    detail::encode_delta_(output, owner, mask);
+    return output.good() ? output.position : 0;
+  }
+
+  /// @brief Reads a delta written by serialize_delta_ from buffer and assigns its values to the tracked_ properties of owner.
+  /// @return The number of bytes read, or 0 if buffer is truncated or does not match the properties of owner ; owner may then be partially updated.
+  /// @remarks The values are decoded in place and do not mark the properties dirty, so that a replica does not send back the changes it receives.
+  template <class owner_t>
+  std::size_t deserialize_delta_(owner_t& owner, const void* buffer, std::size_t size) {
+    detail::buffer_input_ input {static_cast<const unsigned char*>(buffer), size};
+    detail::decoder_<detail::buffer_input_> decoder {input};
+    auto count = std::size_t {0};
+    auto next = std::size_t {0};
+    if (!decoder.length(count) || (count && !decoder.length(next))) return 0;
+    auto succeeded = true;
+    auto position = std::size_t {0};
+    for_each_property_(owner, [&](auto descriptor, auto& property) {
+      if (succeeded && count && position++ == next) {
+        if constexpr (detail::is_tracked_<typename decltype(descriptor)::property_type>::value) {
+          auto previous = next;
+          succeeded = decoder.value(detail::tracked_access_::value(property)) && (--count == 0 || (decoder.length(next) && next > previous));
+        } else succeeded = false;
+      }
+    });
+    return succeeded && count == 0 ? input.position : 0;
+  }
+}
+
+#pragma pop_macro("property_")
+
+/// @brief #tracked_ represent a property_ read write attribute for an auto-property whose writes mark it dirty in a property_dirty_set_.
+/// @ingroup keywords
+#define tracked_ \
+  xtd::tracked_
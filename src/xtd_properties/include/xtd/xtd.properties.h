@@ -1,4 +1,24 @@
 /// @file
 /// @brief Contains property_ class, #get_ and #set_ keywords.
 #pragma once
-#inclue "properties"
+#include "properties"
+#include "atomic_property.h"
+#include "awaitable_property.h"
+#include "cached_property.h"
+#include "computed_property.h"
+#include "cow_property.h"
+#include "indexer_property.h"
+#include "journaled_property.h"
+#include "literal_property.h"
+#include "observable_property.h"
+#include "property_batch.h"
+#include "property_binding.h"
+#include "property_columns.h"
+#include "property_format.h"
+#if defined(XTD_PROPERTIES_INSTRUMENTATION)
+#include "property_instrumentation.h"
+#endif
+#include "property_reflection.h"
+#include "property_serializer.h"
+#include "snapshot_property.h"
+#include "tracked_property.h"
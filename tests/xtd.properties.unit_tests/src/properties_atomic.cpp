@@ -0,0 +1,99 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_atomic_property) {
+    struct point {
+      bool operator==(const point& other) const {return x == other.x && y == other.y;}
+      int x = 0;
+      int y = 0;
+    };
+
+    struct frame {
+      long long first = 0;
+      long long second = 0;
+      long long third = 0;
+    };
+
+  public:
+    void test_method_(get_and_set) {
+      property_<int, atomic_> value {42};
+      assert::are_equal(42, value);
+      value = 24;
+      assert::are_equal(24, value.get());
+      assert::are_equal(24, value.exchange(12));
+      assert::are_equal(12, value());
+    }
+
+    void test_method_(compound_operators) {
+      property_<int, atomic_> value {6};
+      value += 4;
+      value -= 2;
+      value *= 3;
+      value /= 2;
+      value |= 1;
+      value <<= 1;
+      assert::are_equal(26, value);
+    }
+
+    void test_method_(lock_free_and_sequence_lock) {
+      assert::is_true(property_<int, atomic_>::is_lock_free);
+      assert::is_false(property_<frame, atomic_>::is_lock_free);
+
+      property_<point, atomic_> p {point {1, 2}};
+      p.modify([](point& value) {value.x += 10;});
+      assert::is_true(p == point {11, 2});
+
+      property_<frame, atomic_> f;
+      f = frame {1, 2, 3};
+      f.modify([](frame& value) {value.third = 4;});
+      assert::are_equal(4ll, f.get().third);
+    }
+
+    void test_method_(throwing_modify_releases_sequence_lock) {
+      property_<frame, atomic_> value {frame {1, 2, 3}};
+      assert::throws<std::runtime_error>([&] {value.modify([](frame& f) {
+        f.first = 10;
+        throw std::runtime_error("modify");
+      });});
+      auto seen = frame {};
+      std::thread reader([&] {seen = value.get();});
+      reader.join();
+      assert::are_equal(1ll, seen.first);
+      value.modify([](frame& f) {f.third = 4;});
+      assert::are_equal(4ll, value.get().third);
+    }
+
+    void test_method_(concurrent_increments) {
+      property_<int, atomic_> value;
+      std::vector<std::thread> threads;
+      for (auto thread = 0; thread < 4; ++thread)
+        threads.emplace_back([&] {for (auto index = 0; index < 10000; ++index) value += 1;});
+      for (auto& thread : threads) thread.join();
+      assert::are_equal(40000, value);
+    }
+
+    void test_method_(concurrent_reads_never_see_torn_value) {
+      property_<frame, atomic_> value;
+      property_<bool, atomic_> running {true};
+      auto torn = 0;
+      std::thread reader([&] {
+        while (running) {
+          auto f = value.get();
+          if (f.first != f.second || f.second != f.third) ++torn;
+        }
+      });
+      for (auto index = 0ll; index < 20000; ++index)
+        value = frame {index, index, index};
+      running = false;
+      reader.join();
+      assert::are_equal(0, torn);
+    }
+  };
+}
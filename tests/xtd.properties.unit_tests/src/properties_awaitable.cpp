@@ -0,0 +1,188 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_awaitable_property) {
+    // A coroutine that starts at once and is destroyed with its task.
+    struct task {
+      struct promise_type {
+        task get_return_object() {return task {std::coroutine_handle<promise_type>::from_promise(*this)};}
+        std::suspend_never initial_suspend() noexcept {return {};}
+        std::suspend_always final_suspend() noexcept {return {};}
+        void return_void() {}
+        void unhandled_exception() {std::terminate();}
+      };
+
+      explicit task(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+      task(task&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+      ~task() {if (handle) handle.destroy();}
+      bool done() const {return handle.done();}
+
+      std::coroutine_handle<promise_type> handle;
+    };
+
+    // A coroutine that starts at once and lets its exception out of resume().
+    struct throwing_task {
+      struct promise_type {
+        throwing_task get_return_object() {return throwing_task {std::coroutine_handle<promise_type>::from_promise(*this)};}
+        std::suspend_never initial_suspend() noexcept {return {};}
+        std::suspend_always final_suspend() noexcept {return {};}
+        void return_void() {}
+        void unhandled_exception() {throw;}
+      };
+
+      explicit throwing_task(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+      ~throwing_task() {if (handle) handle.destroy();}
+
+      std::coroutine_handle<promise_type> handle;
+    };
+
+    static throwing_task throw_on_change(property_<int, awaitable_>& value) {
+      co_await value.changed();
+      throw std::runtime_error("changed");
+    }
+
+    static task wait_changed(property_<int, awaitable_>& value, std::vector<int>& seen) {
+      seen.push_back(co_await value.changed());
+      seen.push_back(co_await value.changed());
+    }
+
+    static task wait_until(property_<int, awaitable_>& value, int minimum, int& seen) {
+      seen = co_await value.until([minimum](int value) {return value >= minimum;});
+    }
+
+    static task wait_checked(property_<int, awaitable_>& value, int& seen) {
+      seen = co_await value.until([](int value) {
+        if (value == 7) throw std::invalid_argument("value");
+        return value >= 5;
+      });
+    }
+
+    template <class executor_t>
+    static task write_async(property_<std::string, awaitable_>& value, executor_t& executor, bool& written) {
+      co_await value.set_async("written", executor);
+      written = true;
+    }
+
+  public:
+    void test_method_(changed_resumes_on_each_write) {
+      property_<int, awaitable_> value;
+      std::vector<int> seen;
+      auto waiting = wait_changed(value, seen);
+      assert::are_equal(1u, value.waiters());
+      value = 1;
+      value += 2;
+      assert::is_true(waiting.done());
+      assert::are_equal(2u, seen.size());
+      assert::are_equal(1, seen[0]);
+      assert::are_equal(3, seen[1]);
+      assert::are_equal(0u, value.waiters());
+    }
+
+    void test_method_(until_resumes_on_a_matching_value) {
+      property_<int, awaitable_> value;
+      auto low = 0, high = 0;
+      auto waiting_low = wait_until(value, 5, low);
+      auto waiting_high = wait_until(value, 10, high);
+      value = 7;
+      assert::is_true(waiting_low.done());
+      assert::is_false(waiting_high.done());
+      assert::are_equal(7, low);
+      value = 12;
+      assert::is_true(waiting_high.done());
+      assert::are_equal(12, high);
+    }
+
+    void test_method_(until_does_not_wait_for_a_matching_value) {
+      property_<int, awaitable_> value {20};
+      auto seen = 0;
+      auto waiting = wait_until(value, 10, seen);
+      assert::is_true(waiting.done());
+      assert::are_equal(20, seen);
+      assert::are_equal(0u, value.waiters());
+    }
+
+    void test_method_(throwing_predicate_resumes_satisfied_coroutines) {
+      property_<int, awaitable_> value;
+      auto first = 0, checked = 0, last = 0;
+      auto waiting_first = wait_until(value, 5, first);
+      auto waiting_checked = wait_checked(value, checked);
+      auto waiting_last = wait_until(value, 5, last);
+      assert::throws<std::invalid_argument>([&] {value = 7;});
+      assert::is_true(waiting_last.done());
+      assert::are_equal(7, last);
+      assert::are_equal(2u, value.waiters());
+      value = 8;
+      assert::is_true(waiting_first.done());
+      assert::is_true(waiting_checked.done());
+      assert::are_equal(8, first);
+      assert::are_equal(8, checked);
+    }
+
+    void test_method_(throwing_coroutine_resumes_the_others) {
+      property_<int, awaitable_> value;
+      auto first = 0, last = 0;
+      auto throwing = throw_on_change(value);
+      auto waiting_first = wait_until(value, 1, first);
+      auto waiting_last = wait_until(value, 1, last);
+      assert::throws<std::runtime_error>([&] {value = 1;});
+      assert::is_true(waiting_first.done());
+      assert::is_true(waiting_last.done());
+      assert::are_equal(1, first);
+      assert::are_equal(1, last);
+      assert::are_equal(0u, value.waiters());
+    }
+
+    void test_method_(destroyed_coroutine_stops_waiting) {
+      property_<int, awaitable_> value;
+      std::vector<int> seen;
+      {
+        auto waiting = wait_changed(value, seen);
+        assert::are_equal(1u, value.waiters());
+      }
+      assert::are_equal(0u, value.waiters());
+      value = 1;
+      assert::is_true(seen.empty());
+    }
+
+    void test_method_(set_async_runs_on_the_executor) {
+      property_<std::string, awaitable_> value;
+      std::vector<std::function<void()>> jobs;
+      auto executor = [&](auto job) {jobs.push_back(std::move(job));};
+      auto written = false;
+      auto writing = write_async(value, executor, written);
+      assert::are_equal("", value());
+      assert::are_equal(1u, jobs.size());
+      jobs[0]();
+      assert::are_equal("written", value());
+      assert::is_true(written);
+      assert::is_true(writing.done());
+    }
+
+    void test_method_(write_from_another_thread) {
+      property_<int, awaitable_> value;
+      auto seen = 0;
+      auto waiting = wait_until(value, 100, seen);
+      std::thread writer([&] {
+        for (auto index = 1; index <= 100; ++index)
+          value = index;
+      });
+      writer.join();
+      assert::is_true(waiting.done());
+      assert::are_equal(100, seen);
+    }
+  };
+}
+#endif
@@ -0,0 +1,113 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_batch_property) {
+    class person {
+    public:
+      person() = default;
+      person(const person&) = delete;
+
+      property_<std::string> name {
+        get_ {return name_;},
+        set_ {
+          ++name_writes;
+          name_ = std::forward<decltype(value)>(value);
+        }
+      };
+      property_<std::string, observable_> city {"Paris"};
+      property_<int, observable_> age {20};
+
+      int name_writes = 0;
+
+    private:
+      std::string name_;
+    };
+
+  public:
+    void test_method_(writes_are_staged_until_commit) {
+      person p;
+      property_batch_ batch;
+      batch.set(p.name, "Joe").set(p.age, 42);
+      assert::are_equal(2u, batch.size());
+      assert::are_equal("", p.name);
+      assert::are_equal(20, p.age);
+
+      batch.commit();
+      assert::are_equal(0u, batch.size());
+      assert::are_equal("Joe", p.name);
+      assert::are_equal(42, p.age);
+    }
+
+    void test_method_(last_write_wins_and_setter_runs_once) {
+      person p;
+      property_batch_ batch;
+      batch.set(p.name, "Joe");
+      batch.set(p.name, "Jack");
+      batch.set(p.name, std::string("Jane"));
+      assert::are_equal(1u, batch.size());
+      batch.commit();
+      assert::are_equal("Jane", p.name);
+      assert::are_equal(1, p.name_writes);
+    }
+
+    void test_method_(rollback_and_destruction_discard_writes) {
+      person p;
+      {
+        property_batch_ batch;
+        batch.set(p.age, 42);
+        batch.rollback();
+        batch.commit();
+        batch.set(p.age, 24);
+      }
+      assert::are_equal(20, p.age);
+    }
+
+    void test_method_(subscribers_see_the_whole_batch_once) {
+      person p;
+      std::vector<std::string> changes;
+      p.city.subscribe([&](const std::string& old_value, const std::string& new_value) {changes.push_back(old_value + "->" + new_value + " " + std::to_string(p.age()));});
+      p.age.subscribe([&](int old_value, int new_value) {changes.push_back(std::to_string(old_value) + "->" + std::to_string(new_value) + " " + p.city());});
+
+      property_batch_ batch;
+      batch.set(p.city, "Rome");
+      batch.set(p.age, 30);
+      batch.set(p.city, "Oslo");
+      batch.commit();
+
+      assert::are_equal(2u, changes.size());
+      assert::are_equal("Paris->Oslo 30", changes[0]);
+      assert::are_equal("20->30 Oslo", changes[1]);
+    }
+
+    void test_method_(throwing_setter_notifies_applied_writes) {
+      person p;
+      auto checked_value = 0;
+      property_<int> checked {
+        get_ {return checked_value;},
+        set_ {
+          if (value < 0) throw std::invalid_argument("value");
+          checked_value = value;
+        }
+      };
+      std::vector<std::string> changes;
+      p.city.subscribe([&](const std::string& old_value, const std::string& new_value) {changes.push_back(old_value + "->" + new_value);});
+      p.age.subscribe([&](int old_value, int new_value) {changes.push_back(std::to_string(old_value) + "->" + std::to_string(new_value));});
+
+      property_batch_ batch;
+      batch.set(p.city, "Rome").set(checked, -1).set(p.age, 30);
+      assert::throws<std::invalid_argument>([&] {batch.commit();});
+      assert::are_equal("Rome", p.city);
+      assert::are_equal(20, p.age);
+      assert::are_equal(1u, changes.size());
+      assert::are_equal("Paris->Rome", changes[0]);
+      assert::are_equal(0u, batch.size());
+    }
+  };
+}
@@ -0,0 +1,123 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <string>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_property_binding) {
+    class rectangle {
+    public:
+      property_<double, observable_> width {2};
+      property_<double, observable_> height {3};
+      property_<double, observable_> area;
+      property_<double, observable_> perimeter;
+      property_<double> ratio;
+      int ratio_computations = 0;
+
+      property_binding_graph_ bindings;
+    };
+
+  public:
+    void test_method_(one_way_binding) {
+      property_<int, observable_> source {1};
+      property_<int, observable_> middle;
+      property_<int> target;
+      property_binding_graph_ bindings;
+      assert::is_true(bindings.bind(middle, source));
+      assert::is_true(bindings.bind(target, middle));
+      assert::are_equal(1, target());
+      source = 42;
+      assert::are_equal(42, middle());
+      assert::are_equal(42, target());
+    }
+
+    void test_method_(diamond_is_computed_once_per_change) {
+      rectangle r;
+      r.bindings.bind(r.area, [&] {return r.width() * r.height();}, r.width, r.height);
+      r.bindings.bind(r.perimeter, [&] {return 2 * (r.width() + r.height());}, r.width, r.height);
+      r.bindings.bind(r.ratio, [&] {
+        ++r.ratio_computations;
+        return r.area() / r.perimeter();
+      }, r.area, r.perimeter);
+      assert::are_equal(6.0 / 10.0, r.ratio());
+      r.ratio_computations = 0;
+      r.width = 3;
+      assert::are_equal(1, r.ratio_computations);
+      assert::are_equal(9.0 / 12.0, r.ratio());
+    }
+
+    void test_method_(cycle_is_refused) {
+      property_<int, observable_> a, b, c;
+      property_binding_graph_ bindings;
+      assert::is_true(bindings.bind(b, a));
+      assert::is_true(bindings.bind(c, b));
+      assert::is_false(bindings.bind(a, c));
+      assert::is_false(bindings.bind(a, a));
+      assert::is_false(bindings.bind(c, a));
+      a = 5;
+      assert::are_equal(5, c());
+    }
+
+    void test_method_(refused_binding_leaves_graph_unchanged) {
+      property_<int, observable_> a, b, c, d;
+      property_binding_graph_ bindings;
+      assert::is_true(bindings.bind(b, a));
+      assert::are_equal(2u, bindings.size());
+      assert::is_false(bindings.bind(b, c));
+      assert::is_false(bindings.bind(a, [&] {return b() + d();}, d, b));
+      assert::is_false(bindings.bind(d, d));
+      assert::is_false(bindings.bind_two_way(a, b));
+      assert::are_equal(2u, bindings.size());
+      assert::are_equal(0u, c.subscribers());
+      assert::are_equal(0u, d.subscribers());
+    }
+
+    void test_method_(two_way_binding) {
+      property_<std::string, observable_> model {"model"};
+      property_<std::string, observable_> view;
+      property_<std::size_t> length;
+      property_binding_graph_ bindings;
+      assert::is_true(bindings.bind_two_way(model, view));
+      assert::is_true(bindings.bind(length, [&] {return view().size();}, view));
+      assert::are_equal("model", view());
+      view = "typed";
+      assert::are_equal("typed", model());
+      model = "reset!";
+      assert::are_equal("reset!", view());
+      assert::are_equal(6u, length());
+    }
+
+    void test_method_(two_way_cycle_is_refused) {
+      property_<int, observable_> a, b;
+      property_binding_graph_ bindings;
+      assert::is_true(bindings.bind(b, a));
+      assert::is_false(bindings.bind_two_way(a, b));
+    }
+
+    void test_method_(unbind) {
+      property_<int, observable_> source {1};
+      property_<int> target;
+      property_binding_graph_ bindings;
+      bindings.bind(target, source);
+      assert::is_true(bindings.unbind(target));
+      assert::is_false(bindings.unbind(target));
+      source = 2;
+      assert::are_equal(1, target());
+      assert::is_true(bindings.bind(target, source));
+      assert::are_equal(2, target());
+    }
+
+    void test_method_(changed_propagates_a_property_that_cannot_be_subscribed) {
+      property_<int> source {1};
+      property_<int> target;
+      property_binding_graph_ bindings;
+      bindings.bind(target, [&] {return source() * 2;}, source);
+      source = 21;
+      assert::are_equal(2, target());
+      bindings.changed(source);
+      assert::are_equal(42, target());
+    }
+  };
+}
@@ -0,0 +1,103 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <string>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_cached_property) {
+    class person {
+    public:
+      property_<std::string, observable_> first_name {"John"};
+      property_<std::string, observable_> last_name {"Doe"};
+      property_<std::string, cached_> full_name {[&] {
+        ++computations;
+        return first_name() + " " + last_name();
+      }, first_name, last_name};
+      property_<std::size_t, cached_> full_name_length {[&] {return full_name().size();}, full_name};
+
+      int computations = 0;
+    };
+
+  public:
+    void test_method_(computed_once_until_a_source_is_written) {
+      person p;
+      assert::are_equal(0, p.computations);
+      assert::are_equal("John Doe", p.full_name);
+      assert::are_equal("John Doe", p.full_name());
+      assert::is_true(p.full_name == "John Doe");
+      assert::are_equal(1, p.computations);
+
+      p.first_name = "Jane";
+      assert::is_false(p.full_name.is_valid());
+      assert::are_equal("Jane Doe", p.full_name.get());
+      assert::are_equal(2, p.computations);
+    }
+
+    void test_method_(cached_source) {
+      person p;
+      assert::are_equal(8u, p.full_name_length());
+      p.last_name += "-Smith";
+      assert::is_false(p.full_name_length.is_valid());
+      assert::are_equal(14u, p.full_name_length());
+    }
+
+    void test_method_(manual_invalidate) {
+      auto factor = 2;
+      property_<int, cached_> value {[&] {return 21 * factor;}};
+      assert::are_equal(42, value);
+      factor = 3;
+      assert::are_equal(42, value);
+      value.invalidate();
+      assert::are_equal(63, value);
+    }
+
+    void test_method_(depends_on) {
+      property_<int, observable_> source {1};
+      property_<int, cached_> value {[&] {return source() * 10;}};
+      value.depends_on(source);
+      assert::are_equal(10, value);
+      source = 2;
+      assert::are_equal(20, value);
+    }
+
+    void test_method_(dependent_computed_without_reading_a_dirty_source) {
+      property_<int, observable_> source {1};
+      auto read_first = true;
+      property_<int, cached_> first {[&] {return source() * 10;}, source};
+      property_<int, cached_> second {[&] {return read_first ? first() : 0;}, first};
+      assert::are_equal(10, second);
+      source = 2;
+      read_first = false;
+      assert::are_equal(0, second);
+      assert::is_false(first.is_valid());
+      read_first = true;
+      source = 3;
+      assert::is_false(second.is_valid());
+      assert::are_equal(30, second);
+    }
+
+#if !defined(XTD_PROPERTIES_NO_HEAP_ACCESSORS)
+    void test_method_(subscribe_and_unsubscribe_from_subscriber) {
+      property_<int, cached_> value {[] {return 42;}};
+      auto subscriptions = std::vector<subscription_>(3);
+      auto log = std::string {};
+      for (auto index = 0; index < 3; ++index)
+        subscriptions[index] = value.subscribe([&, index, name = std::string(64, char('a' + index))] {
+          value.unsubscribe(subscriptions[index]);
+          for (auto count = 0; count < 16; ++count)
+            value.subscribe([&log, name] {log += name.substr(0, 1);});
+          log += name.substr(0, 1);
+        });
+      assert::are_equal(42, value);
+      value.invalidate();
+      assert::are_equal("abc", log);
+      assert::are_equal(42, value);
+      value.invalidate();
+      assert::are_equal(3u + 48u, log.size());
+    }
+#endif
+  };
+}
@@ -0,0 +1,87 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <string>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_columns_property) {
+    class particle {
+    public:
+      property_<float> x;
+      property_<float> speed;
+      property_<std::string> name;
+      property_<int, readonly_> id {get_ {return id_;}};
+      property_<bool> active;
+
+      reflect_properties_(particle, x, speed, name, id, active);
+
+    private:
+      int id_ = 7;
+    };
+
+  public:
+    void test_method_(store_and_load_rows) {
+      property_columns_<particle> particles;
+      particle p;
+      p.x = 1.5f;
+      p.name = "first";
+      particles.push_back(p);
+      particles.push_back(particle {});
+      assert::are_equal(2u, particles.size());
+      assert::are_equal(1.5f, particles.get<&particle::x>(0));
+      assert::are_equal(7, particles.get<&particle::id>(1));
+
+      particle target;
+      particles.load(0, target);
+      assert::are_equal(1.5f, target.x);
+      assert::are_equal("first", target.name);
+    }
+
+    void test_method_(elements) {
+      property_columns_<particle> particles;
+      particles.resize(3);
+      particles.at<&particle::x>(1) = 2.f;
+      particles.at<&particle::x>(1) += 0.5f;
+      particles.at<&particle::name>(2) = "third";
+      particles.at<&particle::name>(2) += "!";
+      assert::are_equal(2.5f, particles.at<&particle::x>(1).get());
+      assert::is_true(particles.at<&particle::name>(2) == "third!");
+    }
+
+    void test_method_(bool_column) {
+      property_columns_<particle> particles;
+      particle p;
+      p.active = true;
+      particles.push_back(particle {});
+      particles.push_back(p);
+      const bool& first = particles.get<&particle::active>(0);
+      assert::is_false(first);
+      assert::is_true(particles.get<&particle::active>(1));
+      particles.at<&particle::active>(0) = true;
+      particles.resize(100);
+      bool* active = particles.data<&particle::active>();
+      assert::is_true(active[0]);
+      assert::is_false(active[99]);
+      particles.transform<&particle::active>([](bool& active, std::size_t row) {active = row % 2 == 0;});
+      auto copy = particles;
+      particle target;
+      copy.load(98, target);
+      assert::is_true(target.active);
+      copy.load(99, target);
+      assert::is_false(target.active);
+    }
+
+    void test_method_(bulk_columns) {
+      property_columns_<particle> particles;
+      particles.resize(1000);
+      particles.fill<&particle::speed>(2.f);
+      auto speed = particles.data<&particle::speed>();
+      particles.transform<&particle::x>([&](float& x, std::size_t row) {x = static_cast<float>(row) + speed[row];});
+      particles.transform<&particle::x>([](float& x) {x *= 2;});
+      assert::are_equal(4.f, particles.get<&particle::x>(0));
+      assert::are_equal(2002.f, particles.get<&particle::x>(999));
+    }
+  };
+}
@@ -0,0 +1,151 @@
+#include <xtd/properties>
+#include <xtd/xtd.tunit>
+#include <string>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_compile_time_property) {
+    class counter {
+      int value_ = 0;
+      struct get_value {const counter* self; const int& operator()() const {return self->value_;}};
+      struct set_value {counter* self; void operator()(int value) const {self->value_ = value;}};
+      
+    public:
+      counter() = default;
+      counter(const counter& other) : value_(other.value_) {}
+      
+      typed_property_<get_value, set_value> value {get_value {this}, set_value {this}};
+      typed_property_<get_value> read_only_value {get_value {this}};
+      typed_property_<void, set_value> write_only_value {set_value {this}};
+    };
+    
+  public:
+    void test_method_(deduce_read_write_property) {
+      int v = 42;
+      property_ value {
+        get_ {return v;},
+        set_ {v = value;}
+      };
+      
+      assert::is_true(std::is_base_of<readwrite_, decltype(value)>::value);
+      assert::is_true(std::is_same<int, std::decay_t<decltype(value.get())>>::value);
+    }
+    
+    void test_method_(deduce_read_only_property) {
+      int v = 42;
+      property_ value {
+        get_ {return v;}
+      };
+      
+      assert::is_true(std::is_base_of<readonly_, decltype(value)>::value);
+      assert::are_equal(42, value);
+    }
+    
+    void test_method_(accessors_are_the_only_state) {
+      int v = 42;
+      auto getter = get_ {return v;};
+      auto setter = set_ {v = value;};
+      property_ value {getter, setter};
+      
+      assert::are_equal(sizeof(getter) + sizeof(setter), sizeof(value));
+    }
+    
+    void test_method_(get_function_and_functor) {
+      int v = 42;
+      property_ value {
+        get_ {return v;},
+        set_ {v = value;}
+      };
+      
+      assert::are_equal(42, value.get());
+      assert::are_equal(42, value());
+      assert::are_equal(42, value);
+    }
+    
+    void test_method_(create_and_set) {
+      int v = 42;
+      property_ value {
+        get_ {return v;},
+        set_ {v = value;}
+      };
+      
+      value = 24;
+      assert::are_equal(24, v);
+      
+      value(48);
+      assert::are_equal(48, v);
+      
+      value.set(84);
+      assert::are_equal(84, value);
+      assert::are_equal(84, v);
+    }
+    
+    void test_method_(equality_and_inequality_operators) {
+      std::string s = "Test property";
+      property_ value {
+        get_ {return s;},
+        set_ {s = value;}
+      };
+      
+      assert::is_true(value == "Test property");
+      assert::is_false(value != "Test property");
+      assert::is_true(value != "Other thing");
+    }
+    
+    void test_method_(compound_operators) {
+      int v = 42;
+      property_ value {
+        get_ {return v;},
+        set_ {v = value;}
+      };
+      
+      value += 8;
+      assert::are_equal(50, v);
+      value -= 10;
+      assert::are_equal(40, v);
+      value *= 2;
+      assert::are_equal(80, v);
+      value /= 4;
+      assert::are_equal(20, v);
+    }
+    
+    void test_method_(data_member) {
+      counter c;
+      c.value = 42;
+      c.value += 8;
+      assert::are_equal(50, c.value);
+      assert::are_equal(50, c.read_only_value());
+      counter copy = c;
+      copy.value = 24;
+      assert::are_equal(50, c.value);
+      assert::are_equal(24, copy.read_only_value);
+      assert::is_true(std::is_base_of<readonly_, decltype(c.read_only_value)>::value);
+      assert::are_equal(2 * sizeof(void*), sizeof(c.value));
+      c.write_only_value = 7;
+      assert::are_equal(7, c.value);
+      assert::is_true(std::is_base_of<writeonly_, decltype(c.write_only_value)>::value);
+    }
+    
+    void test_method_(write_only_property) {
+      int v = 42;
+      auto setter = set_ {v = value;};
+      property_<int, writeonly_, void, decltype(setter)> value {setter};
+      
+      value = 24;
+      assert::are_equal(24, v);
+      value.set(84);
+      assert::are_equal(84, v);
+    }
+    
+    void test_method_(deduce_write_only_property) {
+      int v = 42;
+      property_ value {[&](int value) {v = value;}};
+      
+      assert::is_true(std::is_base_of<writeonly_, decltype(value)>::value);
+      value = 24;
+      assert::are_equal(24, v);
+    }
+  };
+}
@@ -0,0 +1,74 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_computed_property) {
+    class person {
+    public:
+      std::string first_name = "John";
+      std::string last_name = "Doe";
+
+      property_<std::string, computed_> full_name {
+        compute_ {return first_name + " " + last_name;}
+      };
+      property_<std::size_t, computed_> length {
+        compute_ {return first_name.size() + last_name.size() + 1;}
+      };
+    };
+
+    // Counts the copies and moves of the value returned by a compute_ accessor.
+    struct tracked {
+      tracked() = default;
+      tracked(const tracked&) {++copies;}
+      tracked(tracked&&) {++copies;}
+      int value = 42;
+      inline static int copies = 0;
+    };
+
+  public:
+    void test_method_(computed_on_each_read) {
+      person p;
+      assert::are_equal("John Doe", p.full_name());
+      p.first_name = "Jane";
+      assert::are_equal("Jane Doe", p.full_name.get());
+      assert::are_equal(8u, p.length());
+    }
+
+    void test_method_(implicit_cast_operator) {
+      person p;
+      std::string name = p.full_name;
+      assert::are_equal("John Doe", name);
+    }
+
+    void test_method_(comparison_operators) {
+      person p;
+      assert::is_true(p.full_name == "John Doe");
+      assert::is_true(p.full_name != "Jane Doe");
+    }
+
+    void test_method_(stream_operator) {
+      person p;
+      std::stringstream ss;
+      ss << p.full_name;
+      assert::are_equal("John Doe", ss.str());
+    }
+
+    void test_method_(value_is_not_copied) {
+      property_<tracked, computed_> value {
+        compute_ {return tracked {};}
+      };
+      tracked::copies = 0;
+      tracked result = value.get();
+      tracked converted = value;
+      assert::are_equal(42, result.value);
+      assert::are_equal(42, converted.value);
+      assert::are_equal(0, tracked::copies);
+    }
+  };
+}
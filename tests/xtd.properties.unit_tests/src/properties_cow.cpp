@@ -0,0 +1,95 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <string>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_cow_property) {
+    class document {
+    public:
+      property_<std::string, cow_> text {"Hello"};
+      property_<std::vector<int>, cow_> lines;
+    };
+
+  public:
+    void test_method_(copy_shares_the_value) {
+      document d1;
+      document d2 = d1;
+      assert::is_true(d1.text.is_shared());
+      assert::is_true(&d1.text() == &d2.text());
+      assert::are_equal("Hello", d2.text());
+    }
+
+    void test_method_(write_clones_a_shared_value) {
+      document d1;
+      document d2 = d1;
+      d2.text += " world";
+      assert::are_equal("Hello", d1.text());
+      assert::are_equal("Hello world", d2.text());
+      assert::is_false(d1.text.is_shared());
+      assert::is_false(d2.text.is_shared());
+    }
+
+    void test_method_(write_to_a_value_not_shared_is_in_place) {
+      document d;
+      d.lines.set(std::vector<int>(16));
+      auto data = d.lines().data();
+      d.lines.modify([](std::vector<int>& lines) {lines[0] = 42;});
+      assert::is_true(data == d.lines().data());
+      assert::are_equal(42, d.lines()[0]);
+    }
+
+    void test_method_(assignment_shares_the_value) {
+      document d1;
+      document d2;
+      d1.text = "First";
+      d2.text = d1.text;
+      assert::is_true(&d1.text() == &d2.text());
+      d1.text = "Second";
+      assert::are_equal("First", d2.text());
+      assert::are_equal("Second", d1.text());
+      d2.text = d2.text;
+      assert::are_equal("First", d2.text());
+    }
+
+    void test_method_(default_value_is_shared_until_written) {
+      document d1, d2;
+      assert::is_true(d1.lines.is_shared());
+      assert::is_true(&d1.lines() == &d2.lines());
+      document d3 = d1;
+      d3.lines = std::vector<int> {1};
+      d2.lines.modify([](std::vector<int>& lines) {lines.push_back(2);});
+      assert::is_true(d1.lines().empty());
+      assert::are_equal(1u, d3.lines().size());
+      assert::are_equal(2, d2.lines()[0]);
+      assert::is_false(d2.lines.is_shared());
+      d2.lines = d1.lines;
+      assert::is_true(d2.lines().empty());
+    }
+
+    void test_method_(value_without_default_constructor) {
+      struct identifier {
+        explicit identifier(int value) : value(value) {}
+        int value;
+      };
+      property_<identifier, cow_> first {identifier {1}};
+      auto second = first;
+      second = identifier {2};
+      assert::are_equal(1, first().value);
+      assert::are_equal(2, second().value);
+    }
+
+    void test_method_(emplace_and_set) {
+      document d1;
+      document d2 = d1;
+      d2.text.emplace(3u, 'x');
+      assert::are_equal("xxx", d2.text());
+      assert::are_equal("Hello", d1.text());
+      d1.text.set(d1.text());
+      assert::are_equal("Hello", d1.text);
+    }
+  };
+}
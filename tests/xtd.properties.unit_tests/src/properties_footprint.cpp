@@ -0,0 +1,78 @@
+#include <xtd/properties>
+#include <xtd/xtd.tunit>
+#include <functional>
+#include <string>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_property_footprint) {
+    // An accessor is its inline closure storage, two pointers by default, plus one pointer of dispatch table.
+    static constexpr std::size_t accessor_size = (XTD_PROPERTIES_ACCESSOR_CAPACITY + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*) + sizeof(void*);
+    
+    template <class type_t>
+    static constexpr std::size_t read_write_budget = (sizeof(type_t) > 2 * accessor_size ? sizeof(type_t) : 2 * accessor_size) + sizeof(void*);
+    
+  public:
+    void test_method_(read_write_property_does_not_hold_both_value_and_accessors) {
+      assert::is_less_or_equal(sizeof(property_<int>), read_write_budget<int>);
+      assert::is_less_or_equal(sizeof(property_<std::string>), read_write_budget<std::string>);
+    }
+    
+    void test_method_(read_write_property_is_smaller_than_value_and_two_std_functions) {
+      assert::is_true(sizeof(property_<std::string>) < sizeof(std::string) + 2 * sizeof(std::function<void()>));
+    }
+    
+    void test_method_(read_only_property_holds_one_accessor) {
+      assert::is_less_or_equal(sizeof(property_<std::string, readonly_>), accessor_size);
+    }
+    
+    void test_method_(write_only_property_holds_one_accessor) {
+      assert::is_less_or_equal(sizeof(property_<std::string, writeonly_>), accessor_size);
+    }
+    
+    void test_method_(compile_time_property_holds_only_its_accessors) {
+      std::string s;
+      auto getter = get_ {return s;};
+      auto setter = set_ {s = value;};
+      property_ value {getter, setter};
+      
+      assert::are_equal(sizeof(getter) + sizeof(setter), sizeof(value));
+    }
+    
+    void test_method_(accessor_based_property_does_not_use_backing_value) {
+      std::string s = "Test property";
+      property_<std::string> value {
+        get_ {return s;},
+        set_ {s = value;}
+      };
+      
+      value = "Other thing";
+      assert::are_equal("Other thing", s);
+      assert::are_equal("Other thing", value);
+    }
+    
+#if !defined(XTD_PROPERTIES_NO_HEAP_ACCESSORS)
+    void test_method_(large_accessors_are_still_supported) {
+      std::string first = "Test", middle = " ", last = "property", full;
+      property_<std::string> value {
+        get_ {full = first + middle + last; return full;},
+        set_ {first = value; middle.clear(); last.clear();}
+      };
+      
+      assert::are_equal("Test property", value);
+      value = "Other thing";
+      assert::are_equal("Other thing", value);
+    }
+#endif
+    
+    void test_method_(auto_property_holds_its_value) {
+      property_<std::string> value {"Test property"};
+      
+      assert::are_equal("Test property", value);
+      value = "Other thing";
+      assert::are_equal("Other thing", value);
+    }
+  };
+}
@@ -0,0 +1,57 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <string>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_format_property) {
+    class person {
+    private:
+      int age_ = 42;
+
+    public:
+      member_property_(person, age, int, &person::age_, &person::age_);
+    };
+
+    template <class property_t>
+    static std::string format(const property_t& property) {
+      char buffer[32];
+      auto result = to_chars_(buffer, buffer + sizeof(buffer), property);
+      assert::is_true(result.ec == std::errc {});
+      return std::string(buffer, result.ptr);
+    }
+
+  public:
+    void test_method_(arithmetic_values) {
+      assert::are_equal("42", format(property_<int> {42}));
+      assert::are_equal("-7", format(property_<long long, readonly_> {get_ {static const long long value = -7; return value;}}));
+      assert::are_equal("1.5", format(property_<double> {1.5}));
+      assert::are_equal("true", format(property_<bool> {true}));
+      assert::are_equal("x", format(property_<char> {'x'}));
+      assert::are_equal("42", format(person().age));
+    }
+
+    void test_method_(string_values) {
+      assert::are_equal("Test property", format(property_<std::string> {"Test property"}));
+      assert::are_equal("Test", format(property_<const char*> {"Test"}));
+    }
+
+    void test_method_(buffer_too_small) {
+      char buffer[4];
+      auto result = to_chars_(buffer, buffer + sizeof(buffer), property_<std::string> {"Test property"});
+      assert::is_true(result.ec == std::errc::value_too_large);
+      result = to_chars_(buffer, buffer + sizeof(buffer), property_<int> {123456});
+      assert::is_true(result.ec == std::errc::value_too_large);
+    }
+
+#if defined(__cpp_lib_format)
+    void test_method_(std_format) {
+      property_<int> value {42};
+      assert::are_equal("[  42]", std::format("[{:4}]", value));
+      assert::are_equal("42", std::format("{}", person().age));
+    }
+#endif
+  };
+}
@@ -0,0 +1,133 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <string>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_indexer_property) {
+    class histogram {
+    public:
+      histogram() = default;
+      histogram(const histogram&) = delete;
+
+      property_<int, indexer_> bins {
+        get_at_ {return bins_[index];},
+        set_at_ {
+          ++writes;
+          bins_[index] = value < 0 ? 0 : value;
+        },
+        [&] {return bins_.size();}
+      };
+
+      property_<int, indexer_> raw_bins {
+        get_at_ {return bins_[index];},
+        set_at_ {bins_[index] = value;},
+        [&] {return bins_.size();},
+        [&] {return bins_.data();}
+      };
+
+      property_<int, indexer_> checked_bins {
+        get_at_ {return bins_[index];},
+        set_at_ {
+          ++checked_writes;
+          bins_[index] = value < 0 ? 0 : value;
+        },
+        [&] {return bins_.size();},
+        [&] {return bins_.data();}
+      };
+
+      property_<std::string, indexer_> names {
+        get_at_ {return names_[index];},
+        set_at_ {names_[index] = std::forward<decltype(value)>(value);},
+        [&] {return names_.size();}
+      };
+
+      int writes = 0;
+      int checked_writes = 0;
+
+    private:
+      std::vector<int> bins_ = std::vector<int>(8);
+      std::vector<std::string> names_ = std::vector<std::string>(2);
+    };
+
+  public:
+    void test_method_(element_access) {
+      histogram h;
+      assert::are_equal(8u, h.bins.size());
+      h.bins[3] = 42;
+      h.bins[4] = -1;
+      assert::are_equal(42, h.bins[3]);
+      assert::are_equal(0, h.bins.get(4));
+      assert::is_true(h.bins[3] == 42);
+
+      h.bins[3] += 8;
+      assert::are_equal(50, h.bins[3]);
+      h.bins.set(5, 7);
+      const auto& bins = h.bins;
+      assert::are_equal(7, bins[5]);
+      assert::are_equal(4, h.writes);
+    }
+
+    void test_method_(string_elements) {
+      histogram h;
+      h.names[0] = "Test";
+      h.names[0] += " property";
+      std::string name = "Other";
+      h.names[1] = std::move(name);
+      assert::are_equal("Test property", h.names[0]);
+      assert::are_equal("Other", h.names.get(1));
+    }
+
+    void test_method_(bulk_through_accessors) {
+      histogram h;
+      const int source[] = {1, -2, 3};
+      h.bins.write(2, source, 3);
+      assert::are_equal(3, h.writes);
+      int target[4] = {};
+      h.bins.read(1, target, 4);
+      assert::are_equal(0, target[0]);
+      assert::are_equal(1, target[1]);
+      assert::are_equal(0, target[2]);
+      assert::are_equal(3, target[3]);
+    }
+
+    void test_method_(bulk_through_data) {
+      histogram h;
+      std::vector<int> source {1, 2, 3, 4, 5, 6, 7, 8};
+      h.raw_bins.write_raw(0, source.data(), source.size());
+      assert::are_equal(0, h.writes);
+      assert::are_equal(8, h.bins[7]);
+      std::vector<int> target(8);
+      h.raw_bins.read(0, target.data(), target.size());
+      assert::is_true(source == target);
+    }
+
+    void test_method_(bulk_write_with_data_calls_set_at) {
+      histogram h;
+      const int source[] = {-1, 2};
+      h.checked_bins.write(0, source, 2);
+      assert::are_equal(2, h.checked_writes);
+      assert::are_equal(0, h.bins[0]);
+      h.checked_bins.write_raw(0, source, 2);
+      assert::are_equal(2, h.checked_writes);
+      assert::are_equal(-1, h.bins[0]);
+    }
+
+    void test_method_(bulk_range_is_clamped) {
+      histogram h;
+      const int source[] = {1, 2, 3, 4};
+      assert::are_equal(2u, h.bins.write(6, source, 4));
+      assert::are_equal(2u, h.raw_bins.write_raw(6, source, 4));
+      assert::are_equal(0u, h.bins.write(9, source, 4));
+      int target[4] = {};
+      assert::are_equal(2u, h.raw_bins.read(6, target, 4));
+      assert::are_equal(0u, h.bins.read(8, target, 4));
+      assert::are_equal(1, target[0]);
+      assert::are_equal(2, target[1]);
+      assert::are_equal(0, target[2]);
+    }
+  };
+}
@@ -0,0 +1,81 @@
+#include <xtd/xtd.properties>
+#include <xtd/property_instrumentation.h>
+#include <xtd/xtd.tunit>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_instrumentation_property) {
+    class counter {
+    public:
+      static constexpr int get_line = __LINE__ + 2;
+      property_<int> value {
+        get_ {return value_;},
+        set_ {value_ = value;}
+      };
+      static constexpr int set_line = get_line + 1;
+
+    private:
+      int value_ = 0;
+    };
+
+    static std::uint64_t calls(int line) {
+      auto result = std::uint64_t {0};
+      property_instrumentation_::for_each_site([&](const property_site_& site) {
+        if (site.line == line && std::string(site.file) == __FILE__) result += site.calls;
+      });
+      return result;
+    }
+
+  public:
+    void test_method_(accessors_behave_the_same) {
+      counter c;
+      c.value = 42;
+      c.value += 1;
+      assert::are_equal(43, c.value());
+    }
+
+    void test_method_(calls_are_counted_per_site) {
+      counter c;
+      property_instrumentation_::reset();
+      c.value = 1;
+      c.value = 2;
+      auto value = c.value();
+      assert::are_equal(2, value);
+      if constexpr (property_instrumentation_::enabled) {
+        assert::are_equal(1u, calls(counter::get_line));
+        assert::are_equal(2u, calls(counter::set_line));
+      } else
+        assert::are_equal(0u, calls(counter::get_line));
+    }
+
+    void test_method_(sampled_calls_fill_the_histogram) {
+      counter c;
+      property_instrumentation_::reset();
+      property_instrumentation_::sample_every(2);
+      for (auto index = 0; index < 10; ++index)
+        c.value = index;
+      property_instrumentation_::sample_every(0);
+      auto sampled = std::uint64_t {0};
+      property_instrumentation_::for_each_site([&](const property_site_& site) {
+        if (site.line == counter::set_line)
+          for (const auto& bucket : site.buckets)
+            sampled += bucket;
+      });
+      assert::are_equal(property_instrumentation_::enabled ? 5u : 0u, sampled);
+    }
+
+    void test_method_(report) {
+      counter c;
+      property_instrumentation_::reset();
+      c.value = 1;
+      std::stringstream ss;
+      property_instrumentation_::report(ss);
+      assert::are_equal(property_instrumentation_::enabled, ss.str().find(" set calls=1") != std::string::npos);
+    }
+  };
+}
@@ -0,0 +1,139 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <memory>
+#include <string>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_journaled_property) {
+    struct point {
+      double x = 0;
+      double y = 0;
+      bool operator==(const point& other) const {return x == other.x && y == other.y;}
+      bool operator!=(const point& other) const {return !(*this == other);}
+    };
+
+    class shape {
+    public:
+      property_journal_ journal {4};
+      property_<int, journaled_> width {journal};
+      property_<std::string, journaled_> name {journal, "shape"};
+      property_<point, journaled_> origin {journal};
+    };
+
+  public:
+    void test_method_(undo_and_redo) {
+      shape s;
+      s.width = 10;
+      s.name = "square";
+      assert::are_equal(2u, s.journal.size());
+      assert::are_equal(2u, s.journal.undo(2));
+      assert::are_equal(0, s.width());
+      assert::are_equal("shape", s.name());
+      assert::is_false(s.journal.can_undo());
+      assert::are_equal(1u, s.journal.redo());
+      assert::are_equal(10, s.width());
+      assert::are_equal("shape", s.name());
+      assert::is_true(s.journal.can_redo());
+    }
+
+    void test_method_(compound_operators_and_modify_are_recorded) {
+      shape s;
+      s.width = 10;
+      s.width += 5;
+      s.name += "s";
+      s.origin.modify([](point& p) {p.x = 1;});
+      assert::are_equal(4u, s.journal.size());
+      s.journal.undo(3);
+      assert::are_equal(10, s.width());
+      assert::are_equal("shape", s.name());
+      assert::is_true(s.origin() == point {});
+    }
+
+    void test_method_(position_marks_a_group_of_writes) {
+      shape s;
+      s.width = 1;
+      auto mark = s.journal.position();
+      s.width = 2;
+      s.origin = point {3, 4};
+      s.journal.undo(s.journal.position() - mark);
+      assert::are_equal(mark, s.journal.position());
+      assert::are_equal(1, s.width());
+      assert::is_true(s.origin() == point {});
+    }
+
+    void test_method_(write_after_undo_discards_redo) {
+      shape s;
+      s.width = 1;
+      s.width = 2;
+      s.journal.undo();
+      s.width = 3;
+      assert::is_false(s.journal.can_redo());
+      assert::are_equal(0u, s.journal.redo());
+      s.journal.undo(2);
+      assert::are_equal(0, s.width());
+    }
+
+    void test_method_(full_journal_drops_oldest_writes) {
+      shape s;
+      for (auto width = 1; width <= 6; ++width)
+        s.width = width;
+      assert::are_equal(4u, s.journal.size());
+      assert::are_equal(4u, s.journal.undo(10));
+      assert::are_equal(2, s.width());
+    }
+
+    void test_method_(truncate_and_clear) {
+      shape s;
+      s.width = 1;
+      s.width = 2;
+      s.width = 3;
+      s.journal.truncate(1);
+      assert::are_equal(1u, s.journal.size());
+      s.journal.undo();
+      assert::are_equal(2, s.width());
+      s.journal.clear();
+      assert::is_false(s.journal.can_undo());
+      assert::is_false(s.journal.can_redo());
+    }
+
+    void test_method_(destroyed_property_is_skipped) {
+      property_journal_ journal;
+      property_<int, journaled_> kept {journal};
+      auto removed = std::make_unique<property_<int, journaled_>>(journal);
+      kept = 1;
+      *removed = 2;
+      removed.reset();
+      assert::are_equal(2u, journal.undo(2));
+      assert::are_equal(0, kept());
+    }
+
+    void test_method_(destroyed_property_with_dropped_writes) {
+      property_journal_ journal {2};
+      property_<int, journaled_> kept {journal};
+      auto removed = std::make_unique<property_<int, journaled_>>(journal);
+      *removed = 1;
+      *removed = 2;
+      kept = 3;
+      removed.reset();
+      assert::are_equal(2u, journal.undo(2));
+      assert::are_equal(0, kept());
+      journal.clear();
+      removed = std::make_unique<property_<int, journaled_>>(journal);
+      *removed = 4;
+      journal.clear();
+      removed.reset();
+      assert::is_false(journal.can_undo());
+    }
+
+    void test_method_(without_journal_nothing_is_recorded) {
+      property_<int, journaled_> value {42};
+      value = 84;
+      value += 1;
+      assert::is_null(value.journal());
+      assert::are_equal(85, value());
+    }
+  };
+}
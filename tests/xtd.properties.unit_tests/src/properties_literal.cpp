@@ -0,0 +1,69 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <sstream>
+#include <type_traits>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  namespace {
+    struct channel {
+      property_<int, literal_> frequency;
+      property_<double, literal_> gain {1.0};
+      property_<unsigned, literal_> flags {0x0Fu};
+    };
+
+    constexpr channel make_channel(int frequency) {
+      channel result;
+      result.frequency = frequency;
+      result.gain *= 2.0;
+      result.flags &= 0x03u;
+      result.flags <<= 1u;
+      return result;
+    }
+
+    constexpr channel channels[] {make_channel(440), make_channel(880)};
+  }
+
+  class test_class_(test_literal_property) {
+  public:
+    void test_method_(owner_is_a_literal_type) {
+      assert::is_true(std::is_trivially_copyable<channel>::value);
+      assert::is_true(std::is_trivially_destructible<channel>::value);
+      assert::are_equal(sizeof(int), sizeof(property_<int, literal_>));
+    }
+
+    void test_method_(constant_expressions) {
+      static_assert(channels[0].frequency == 440);
+      static_assert(channels[1].frequency.get() == 880);
+      static_assert(channels[1].gain() == 2.0);
+      static_assert(channels[0].flags == 6u);
+      constexpr const int& frequency = channels[1].frequency;
+      assert::are_equal(880, frequency);
+    }
+
+    void test_method_(modify_in_constant_expression) {
+      constexpr auto value = [] {
+        property_<int, literal_> result {40};
+        result.modify([](int& value) {value += 1;});
+        result.set(result() + 1);
+        return result;
+      }();
+      static_assert(value == 42);
+      assert::are_equal(42, value.get());
+    }
+
+    void test_method_(runtime_access) {
+      channel c = channels[0];
+      c.frequency = 220;
+      c.frequency += 5;
+      c.gain.emplace(0.5);
+      assert::are_equal(225, c.frequency());
+      assert::are_equal(0.5, c.gain());
+      std::stringstream ss;
+      ss << c.frequency;
+      assert::are_equal("225", ss.str());
+    }
+  };
+}
@@ -0,0 +1,160 @@
+#include <xtd/properties>
+#include <xtd/xtd.tunit>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_member_property) {
+    class point {
+    private:
+      int x_ = 0;
+      int y_ = 0;
+      
+    public:
+      point() = default;
+      point(int x, int y) : x_(x), y_(y) {}
+      
+      member_property_(point, x, int, &point::x_, &point::x_);
+      member_property_(point, y, int, &point::y_);
+    };
+    
+    class person {
+    private:
+      std::string name_ = "N/A";
+      int age_ = 0;
+      int get_age() const {return age_;}
+      void set_age(int age) {age_ = age < 0 ? 0 : age;}
+      
+    public:
+      member_property_(person, name, std::string, &person::name_, &person::name_);
+      member_property_(person, age, int, &person::get_age, &person::set_age);
+    };
+    
+    class size {
+    private:
+      int width_ = 0;
+      int height_ = 0;
+      
+    public:
+      size() = default;
+      size(int width, int height) : width_(width), height_(height) {}
+      
+      member_property_(size, width, int, &size::width_);
+      member_property_(size, height, int, &size::height_);
+    };
+    
+  public:
+    void test_method_(owner_is_trivially_copy_constructible_and_movable) {
+      assert::is_true(std::is_trivially_copy_constructible<point>::value);
+      assert::is_true(std::is_trivially_move_constructible<point>::value);
+      assert::is_true(std::is_trivially_move_assignable<point>::value);
+      assert::is_true(std::is_trivially_destructible<point>::value);
+    }
+    
+    void test_method_(owner_with_read_only_properties_is_trivially_copyable) {
+      assert::is_true(std::is_trivially_copyable<size>::value);
+      size s1 {1, 2}, s2;
+      s2 = s1;
+      assert::are_equal(2, s2.height);
+    }
+    
+    void test_method_(assign_property_of_another_owner) {
+      point p1 {12, 24}, p2;
+      p2.x = p1.x;
+      assert::are_equal(12, p2.x);
+      
+      const person joe = [] {
+        person p;
+        p.name = "Joe";
+        p.age = 42;
+        return p;
+      }();
+      person copy;
+      copy.name = joe.name;
+      copy.age = joe.age;
+      assert::are_equal("Joe", copy.name);
+      assert::are_equal(42, copy.age);
+    }
+    
+    void test_method_(owner_copy_and_move_assignment) {
+      person joe;
+      joe.name = "Joe";
+      joe.age = 42;
+      person copy;
+      copy = joe;
+      assert::are_equal("Joe", copy.name);
+      assert::are_equal(42, copy.age);
+      
+      person moved;
+      moved = std::move(copy);
+      assert::are_equal("Joe", moved.name);
+      assert::are_equal(42, moved.age);
+    }
+    
+    void test_method_(property_holds_no_state) {
+      assert::is_true(std::is_empty<decltype(point::x)>::value);
+    }
+    
+    void test_method_(attributes) {
+      assert::is_true(std::is_base_of<readwrite_, decltype(point::x)>::value);
+      assert::is_true(std::is_base_of<readonly_, decltype(point::y)>::value);
+    }
+    
+    void test_method_(get_and_set_field) {
+      point p {12, 24};
+      
+      assert::are_equal(12, p.x);
+      assert::are_equal(24, p.y());
+      p.x = 42;
+      assert::are_equal(42, p.x.get());
+      p.x += 8;
+      assert::are_equal(50, p.x);
+    }
+    
+    void test_method_(implicit_copy_reads_copied_owner) {
+      point p1 {12, 24};
+      point p2 = p1;
+      p1.x = 42;
+      
+      assert::are_equal(12, p2.x);
+      assert::are_equal(42, p1.x);
+    }
+    
+    void test_method_(member_function_accessors) {
+      person p;
+      
+      p.age = -4;
+      assert::are_equal(0, p.age);
+      p.age = 42;
+      p.age += 8;
+      assert::are_equal(50, p.age);
+    }
+    
+    void test_method_(modify_field_in_place) {
+      person p;
+      p.name = "Joe";
+      
+      p.name += " Smith";
+      assert::are_equal("Joe Smith", p.name);
+    }
+    
+    void test_method_(owners_in_reallocating_vector) {
+      std::vector<person> persons;
+      for (auto index = 0; index < 100; ++index) {
+        persons.emplace_back();
+        persons.back().age = 100 - index;
+        persons.back().name = std::to_string(index);
+      }
+      
+      std::sort(persons.begin(), persons.end(), [](const person& a, const person& b) {return a.age() < b.age();});
+      assert::are_equal(1, persons.front().age);
+      assert::are_equal("99", persons.front().name);
+      assert::are_equal(100, persons.back().age);
+      assert::are_equal("0", persons.back().name);
+    }
+  };
+}
@@ -0,0 +1,118 @@
+#include <xtd/properties>
+#include <xtd/xtd.tunit>
+#include <string>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_modify_property) {
+    struct money {
+      money operator+(const money& other) const {return {cents + other.cents};}
+      bool operator==(const money& other) const {return cents == other.cents;}
+      int cents = 0;
+    };
+    
+  public:
+    void test_method_(auto_property_modify_in_place) {
+      property_<std::string> value;
+      value.modify([](std::string& s) {s.reserve(64);});
+      auto data = value().data();
+      
+      value += "Test";
+      value += " property";
+      assert::are_equal("Test property", value);
+      assert::is_true(data == value().data());
+    }
+    
+    void test_method_(mutate_accessor_modify_in_place) {
+      std::string log;
+      log.reserve(64);
+      auto data = log.data();
+      property_<std::string> value {
+        get_ {return log;},
+        mutate_ {return log;}
+      };
+      
+      value += "Test";
+      value.modify([](std::string& s) {s += " property";});
+      assert::are_equal("Test property", log);
+      assert::is_true(data == log.data());
+    }
+    
+    void test_method_(mutate_accessor_assign) {
+      std::string log;
+      property_<std::string> value {
+        get_ {return log;},
+        mutate_ {return log;}
+      };
+      
+      value = "Test property";
+      assert::are_equal("Test property", log);
+    }
+    
+    void test_method_(set_accessor_modify_through_get_and_set) {
+      int v = 42;
+      int set_count = 0;
+      property_<int> value {
+        get_ {return v;},
+        set_ {v = value; ++set_count;}
+      };
+      
+      value.modify([](int& i) {i *= 2;});
+      assert::are_equal(84, v);
+      assert::are_equal(1, set_count);
+      
+      value -= 4;
+      assert::are_equal(80, v);
+      assert::are_equal(2, set_count);
+    }
+    
+    void test_method_(compile_time_mutate_accessor_modify_in_place) {
+      std::vector<int> v;
+      property_ value {
+        get_ {return v;},
+        mutate_ {return v;}
+      };
+      
+      value.modify([](std::vector<int>& items) {items.push_back(42);});
+      value = std::vector<int> {1, 2};
+      value.modify([](std::vector<int>& items) {items.push_back(3);});
+      assert::are_equal(3u, v.size());
+      assert::are_equal(3, v[2]);
+    }
+    
+    void test_method_(compound_operator_without_in_place_operator) {
+      property_<money> value {money {40}};
+      
+      value += money {2};
+      assert::are_equal(42, value().cents);
+    }
+    
+    void test_method_(all_compound_operators) {
+      property_<int> value {42};
+      
+      value += 8;
+      assert::are_equal(50, value);
+      value -= 10;
+      assert::are_equal(40, value);
+      value *= 2;
+      assert::are_equal(80, value);
+      value /= 4;
+      assert::are_equal(20, value);
+      value %= 7;
+      assert::are_equal(6, value);
+      value &= 3;
+      assert::are_equal(2, value);
+      value |= 5;
+      assert::are_equal(7, value);
+      value ^= 1;
+      assert::are_equal(6, value);
+      value <<= 2;
+      assert::are_equal(24, value);
+      value >>= 3;
+      assert::are_equal(3, value);
+    }
+  };
+}
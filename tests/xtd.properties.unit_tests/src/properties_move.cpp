@@ -0,0 +1,116 @@
+#include <xtd/properties>
+#include <xtd/xtd.tunit>
+#include <string>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_move_property) {
+    struct payload {
+      payload() = default;
+      payload(int id) : id(id) {}
+      payload(int id, int copies) noexcept : id(id), copies(copies) {}
+      payload(const payload& other) : id(other.id), copies(other.copies + 1), moves(other.moves) {}
+      payload(payload&& other) noexcept : id(other.id), copies(other.copies), moves(other.moves + 1) {}
+      payload& operator=(const payload& other) {id = other.id; copies = other.copies + 1; moves = other.moves; return *this;}
+      payload& operator=(payload&& other) noexcept {id = other.id; copies = other.copies; moves = other.moves + 1; return *this;}
+      bool operator==(const payload& other) const {return id == other.id;}
+      bool operator!=(const payload& other) const {return id != other.id;}
+      
+      int id = 0;
+      int copies = 0;
+      int moves = 0;
+    };
+    
+  public:
+    void test_method_(auto_property_moves_rvalue) {
+      property_<payload> value;
+      
+      value = payload {42};
+      assert::are_equal(42, value().id);
+      assert::are_equal(0, value().copies);
+    }
+    
+    void test_method_(auto_property_copies_lvalue) {
+      property_<payload> value;
+      payload p {42};
+      
+      value = p;
+      assert::are_equal(1, value().copies);
+    }
+    
+    void test_method_(accessor_property_moves_rvalue_into_field) {
+      payload v;
+      property_<payload> value {
+        get_ {return v;},
+        set_ {v = std::forward<decltype(value)>(value);}
+      };
+      
+      value.set(payload {42});
+      assert::are_equal(42, v.id);
+      assert::are_equal(0, v.copies);
+      
+      value(payload {24});
+      assert::are_equal(24, v.id);
+      assert::are_equal(0, v.copies);
+    }
+    
+    void test_method_(accessor_property_copies_lvalue_once) {
+      payload v;
+      property_<payload> value {
+        get_ {return v;},
+        set_ {v = std::forward<decltype(value)>(value);}
+      };
+      
+      payload p {42};
+      value = p;
+      assert::are_equal(1, v.copies);
+    }
+    
+    void test_method_(write_only_property_moves_rvalue) {
+      payload v;
+      property_<payload, writeonly_> value {
+        set_ {v = std::forward<decltype(value)>(value);}
+      };
+      
+      value = payload {42};
+      assert::are_equal(42, v.id);
+      assert::are_equal(0, v.copies);
+    }
+    
+    void test_method_(compile_time_property_moves_rvalue) {
+      payload v;
+      property_ value {
+        get_ {return v;},
+        set_ {v = std::forward<decltype(value)>(value);}
+      };
+      
+      value = payload {42};
+      assert::are_equal(42, v.id);
+      assert::are_equal(0, v.copies);
+    }
+    
+    void test_method_(emplace_auto_property) {
+      property_<payload> value;
+      
+      value.emplace(42, 0);
+      assert::are_equal(42, value().id);
+      assert::are_equal(0, value().copies);
+      assert::are_equal(0, value().moves);
+    }
+    
+    void test_method_(emplace_accessor_property) {
+      std::vector<int> v;
+      property_<std::vector<int>> value {
+        get_ {return v;},
+        set_ {v = std::forward<decltype(value)>(value);}
+      };
+      
+      value.emplace(3, 42);
+      assert::are_equal(3u, v.size());
+      assert::are_equal(42, v[2]);
+    }
+  };
+}
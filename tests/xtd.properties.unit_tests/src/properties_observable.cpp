@@ -0,0 +1,134 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <string>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_observable_property) {
+  public:
+    void test_method_(write_without_subscriber) {
+      property_<std::string, observable_> value {"Default"};
+      assert::are_equal("Default", value);
+      value = "Test property";
+      assert::are_equal("Test property", value);
+      assert::are_equal(0u, value.subscribers());
+    }
+
+    void test_method_(subscriber_receives_old_and_new_values) {
+      property_<std::string, observable_> value {"Default"};
+      std::vector<std::string> changes;
+      value.subscribe([&](const std::string& old_value, const std::string& new_value) {changes.push_back(old_value + "->" + new_value);});
+
+      value = "One";
+      value.set("Two");
+      value += "!";
+      assert::are_equal(3u, changes.size());
+      assert::are_equal("Default->One", changes[0]);
+      assert::are_equal("One->Two", changes[1]);
+      assert::are_equal("Two->Two!", changes[2]);
+    }
+
+    void test_method_(unsubscribe_stops_notifications) {
+      property_<int, observable_> value;
+      auto count = 0;
+      auto subscription = value.subscribe([&](int, int) {++count;});
+      value = 1;
+      assert::is_true(value.unsubscribe(subscription));
+      assert::is_false(value.unsubscribe(subscription));
+      value = 2;
+      assert::are_equal(1, count);
+      assert::are_equal(0u, value.subscribers());
+    }
+
+    void test_method_(many_subscribers) {
+      property_<int, observable_> value;
+      auto sum = 0;
+      std::vector<subscription_> subscriptions;
+      for (auto index = 0; index < 5; ++index)
+        subscriptions.push_back(value.subscribe([&sum, index](int, int new_value) {sum += new_value * (index + 1);}));
+      value = 1;
+      assert::are_equal(15, sum);
+
+      value.unsubscribe(subscriptions[0]);
+      value.unsubscribe(subscriptions[3]);
+      value = 2;
+      assert::are_equal(15 + 2 * (2 + 3 + 5), sum);
+      assert::are_equal(3u, value.subscribers());
+    }
+
+#if !defined(XTD_PROPERTIES_NO_HEAP_ACCESSORS)
+    void test_method_(unsubscribe_from_subscriber) {
+      property_<int, observable_> value;
+      auto count = 0;
+      subscription_ subscription;
+      subscription = value.subscribe([&](int, int) {
+        ++count;
+        value.unsubscribe(subscription);
+      });
+      value = 1;
+      value = 2;
+      assert::are_equal(1, count);
+    }
+
+    void test_method_(unsubscribe_heap_closure_from_subscriber) {
+      property_<int, observable_> value;
+      auto subscriptions = std::vector<subscription_>(3);
+      auto log = std::string {};
+      for (auto index = 0; index < 3; ++index)
+        subscriptions[index] = value.subscribe([&, index, name = std::string(64, char('a' + index))](int, int) {
+          value.unsubscribe(subscriptions[index]);
+          log += name.substr(0, 1);
+        });
+      value = 1;
+      value = 2;
+      assert::are_equal("abc", log);
+      assert::are_equal(0u, value.subscribers());
+    }
+
+    void test_method_(subscribe_from_subscriber) {
+      property_<int, observable_> value;
+      auto added = std::vector<int> {};
+      for (auto index = 0; index < 3; ++index)
+        value.subscribe([&, name = std::string(64, 'x')](int, int) {
+          for (auto count = 0; count < 16; ++count)
+            value.subscribe([&added, name](int, int new_value) {added.push_back(new_value + int(name.size()) - 64);});
+        });
+      value = 1;
+      assert::is_true(added.empty());
+      assert::are_equal(51u, value.subscribers());
+      value = 2;
+      assert::are_equal(48u, added.size());
+      assert::are_equal(2, added.back());
+    }
+#endif
+
+    void test_method_(skip_unchanged) {
+      property_<int, observable_> value {42};
+      auto count = 0;
+      value.subscribe([&](int, int) {++count;});
+      value = 42;
+      assert::are_equal(1, count);
+
+      value.skip_unchanged(true);
+      value = 42;
+      value += 0;
+      assert::are_equal(1, count);
+      value = 24;
+      assert::are_equal(2, count);
+    }
+
+    void test_method_(copy_does_not_copy_subscribers) {
+      property_<int, observable_> value {42};
+      auto count = 0;
+      value.subscribe([&](int, int) {++count;});
+      property_<int, observable_> copy = value;
+      copy = 24;
+      assert::are_equal(42, value);
+      assert::are_equal(24, copy);
+      assert::are_equal(0, count);
+    }
+  };
+}
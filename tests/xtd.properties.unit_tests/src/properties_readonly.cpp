@@ -1,5 +1,7 @@
 #include <xtd/properties>
 #include <xtd/xtd.tunit>
+#include <memory>
+#include <string>
 
 using namespace xtd;
 using namespace xtd::tunit;
@@ -16,6 +18,16 @@ namespace unit_tests {
       assert::are_equal(42, value);
     }
 
+    void test_method_(implicit_cast_operator_does_not_copy) {
+      int v = 42;
+      property_<int, readonly_> value {
+        get_ {return v;}
+      };
+      
+      const int& reference = value;
+      assert::is_true(&reference == &v);
+    }
+
     void test_method_(get_functor) {
       int v = 42;
       property_<int, readonly_> value {
@@ -0,0 +1,108 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <stdexcept>
+#include <string>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_rebind_property) {
+    class sensor {
+    public:
+      property_<int> value {
+        get_ {return value_;},
+        set_ {value_ = value;}
+      };
+
+      int value_ = 42;
+    };
+
+  public:
+    void test_method_(rebind_getter) {
+      sensor s;
+      int fake = 84;
+      assert::is_true(s.value.rebind_getter(get_ {return fake;}));
+      assert::are_equal(84, s.value());
+      s.value = 21;
+      assert::are_equal(21, s.value_);
+      assert::are_equal(84, s.value());
+    }
+
+    void test_method_(rebind_setter) {
+      sensor s;
+      auto writes = 0;
+      assert::is_true(s.value.rebind_setter(set_ {++writes; s.value_ = value * 2;}));
+      s.value = 21;
+      s.value += 1;
+      assert::are_equal(2, writes);
+      assert::are_equal(86, s.value());
+    }
+
+    void test_method_(rebind_mutator) {
+      sensor s;
+      int other = 1;
+      s.value.rebind_setter(mutate_ {return other;});
+      s.value = 5;
+      assert::are_equal(5, other);
+      assert::are_equal(42, s.value_);
+    }
+
+    void test_method_(rebind_auto_property_fails) {
+      property_<std::string> value {"Test"};
+      std::string other = "Other";
+      assert::is_false(value.rebind_getter(get_ {return other;}));
+      assert::is_false(value.rebind_setter(set_ {other = value;}));
+      value = "Changed";
+      assert::are_equal("Changed", value());
+      assert::are_equal("Other", other);
+    }
+
+    void test_method_(rebind_read_only_and_write_only) {
+      int first = 1, second = 2, target = 0;
+      property_<int, readonly_> read {get_ {return first;}};
+      property_<int, writeonly_> write {set_ {target = value;}};
+      read.rebind_getter(get_ {return second;});
+      write.rebind_setter(set_ {target = -value;});
+      assert::are_equal(2, read());
+      write = 3;
+      assert::are_equal(-3, target);
+    }
+
+    void test_method_(rebind_checked_inline_accessor) {
+      auto first = 1, second = 2;
+      property_<int, readonly_> read {inline_accessor_(get_ {return first;})};
+      read.rebind_getter(inline_accessor_(get_ {return second;}));
+      assert::are_equal(2, read());
+
+      auto small = [&first, &second] {return first + second;};
+      auto large = [first, second, third = 3.0, fourth = 4.0] {return first + second + int(third + fourth);};
+      assert::is_true(is_inline_accessor_<decltype(small)>);
+      assert::is_false(is_inline_accessor_<decltype(large)>);
+    }
+
+#if !defined(XTD_PROPERTIES_NO_HEAP_ACCESSORS)
+    void test_method_(throwing_rebind_keeps_accessor) {
+      struct throwing_getter {
+        throwing_getter() = default;
+        throwing_getter(const throwing_getter&) {throw std::runtime_error("copy");}
+        const int& operator()() const {return value;}
+        int value = 84;
+      };
+      sensor s;
+      throwing_getter getter;
+      assert::throws<std::runtime_error>([&] {s.value.rebind_getter(getter);});
+      assert::are_equal(42, s.value());
+      s.value = 21;
+      assert::are_equal(21, s.value());
+    }
+#endif
+
+    void test_method_(rebind_computed) {
+      int a = 2, b = 3;
+      property_<int, computed_> sum {compute_ {return a + b;}};
+      sum.rebind_getter(compute_ {return a * b;});
+      assert::are_equal(6, sum());
+    }
+  };
+}
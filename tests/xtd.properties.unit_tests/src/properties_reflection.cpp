@@ -0,0 +1,86 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <sstream>
+#include <string>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_reflection_property) {
+    class person {
+    private:
+      int age_ = 42;
+      std::string password_;
+      double height_ = 1.8;
+
+    public:
+      property_<std::string> name;
+      property_<int, readonly_> age {get_ {return age_;}};
+      property_<std::string, writeonly_> password {set_ {password_ = std::forward<decltype(value)>(value);}};
+      member_property_(person, height, double, &person::height_, &person::height_);
+
+      const std::string& secret() const {return password_;}
+
+    private:
+      reflect_properties_(person, name, age, password, height);
+    };
+
+    struct point {
+      property_<int> x;
+      property_<int> y;
+      reflect_properties_(point, x, y);
+    };
+
+    struct plain {
+      int value = 0;
+    };
+
+  public:
+    void test_method_(descriptors) {
+      static_assert(is_reflectable_<person>);
+      static_assert(!is_reflectable_<plain>);
+      static_assert(property_count_<person> == 4);
+
+      constexpr auto properties = properties_of_<person>();
+      static_assert(std::get<0>(properties).name == "name");
+      static_assert(std::get<3>(properties).name == "height");
+
+      using age_descriptor = std::tuple_element_t<1, decltype(properties)>;
+      static_assert(std::is_same<age_descriptor::value_type, int>::value);
+      static_assert(std::is_same<age_descriptor::attribute_type, readonly_>::value);
+      static_assert(age_descriptor::can_read && !age_descriptor::can_write);
+
+      using password_descriptor = std::tuple_element_t<2, decltype(properties)>;
+      static_assert(std::is_same<password_descriptor::attribute_type, writeonly_>::value);
+      static_assert(std::is_same<std::tuple_element_t<3, decltype(properties)>::value_type, double>::value);
+      assert::is_true(true);
+    }
+
+    void test_method_(visit_readable_properties) {
+      person p;
+      p.name = "Joe";
+      std::string result;
+      for_each_property_(p, [&](auto descriptor, auto& property) {
+        if constexpr (decltype(descriptor)::can_read) {
+          std::ostringstream os;
+          os << property;
+          result += std::string(descriptor.name) + "=" + os.str() + ";";
+        }
+      });
+      assert::are_equal("name=Joe;age=42;height=1.8;", result);
+    }
+
+    void test_method_(set_through_descriptors) {
+      point pt;
+      auto value = 0;
+      for_each_property_<point>([&](auto descriptor) {descriptor.set(pt, ++value * 10);});
+      assert::are_equal(10, pt.x);
+      assert::are_equal(20, pt.y);
+
+      person p;
+      std::get<2>(properties_of_<person>()).set(p, "secret");
+      assert::are_equal("secret", p.secret());
+    }
+  };
+}
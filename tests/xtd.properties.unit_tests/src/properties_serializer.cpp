@@ -0,0 +1,174 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_serializer_property) {
+    struct address {
+      property_<std::string> city;
+      property_<int> zip;
+      reflect_properties_(address, city, zip);
+    };
+
+    enum class color : unsigned char {red, green, blue};
+
+    struct settings {
+      property_<bool> enabled;
+      property_<color> background;
+      property_<std::vector<color>> palette;
+      reflect_properties_(settings, enabled, background, palette);
+    };
+
+    class person {
+    private:
+      double height_ = 0;
+      int id_ = 7;
+
+    public:
+      person() = default;
+      person(const person& other) : height_(other.height_), id_(other.id_), name(other.name), age(other.age), scores(other.scores), tags(other.tags), home(other.home) {}
+
+      property_<std::string> name;
+      property_<int, observable_> age;
+      member_property_(person, height, double, &person::height_, &person::height_);
+      property_<std::vector<int>> scores;
+      property_<std::vector<std::string>> tags;
+      property_<address> home;
+      property_<int, readonly_> id {get_ {return id_;}};
+
+      reflect_properties_(person, name, age, height, scores, tags, home, id);
+    };
+
+    static person make_person() {
+      person p;
+      p.name = "Joe";
+      p.age = 42;
+      p.height = 1.8;
+      p.scores = std::vector<int> {1, 2, 3};
+      p.tags = std::vector<std::string> {"a", "bc", std::string(200, 'x')};
+      p.home.modify([](address& a) {
+        a.city = "Paris";
+        a.zip = 75000;
+      });
+      return p;
+    }
+
+    static void check(const person& p) {
+      assert::are_equal("Joe", p.name);
+      assert::are_equal(42, p.age);
+      assert::are_equal(1.8, p.height());
+      assert::are_equal(3u, p.scores().size());
+      assert::are_equal(3, p.scores()[2]);
+      assert::are_equal(3u, p.tags().size());
+      assert::are_equal(std::string(200, 'x'), p.tags()[2]);
+      assert::are_equal("Paris", p.home().city);
+      assert::are_equal(75000, p.home().zip);
+    }
+
+  public:
+    void test_method_(round_trip) {
+      auto source = make_person();
+      std::vector<unsigned char> buffer(serialized_size_(source));
+      assert::are_equal(buffer.size(), serialize_(source, buffer.data(), buffer.size()));
+
+      person target;
+      auto notifications = 0;
+      target.age.subscribe([&](int, int) {++notifications;});
+      assert::are_equal(buffer.size(), deserialize_(target, buffer.data(), buffer.size()));
+      check(target);
+      assert::are_equal(1, notifications);
+    }
+
+    void test_method_(buffer_too_small_and_truncated_input) {
+      auto source = make_person();
+      std::vector<unsigned char> buffer(serialized_size_(source));
+      assert::are_equal(0u, serialize_(source, buffer.data(), buffer.size() - 1));
+      serialize_(source, buffer.data(), buffer.size());
+      person target;
+      assert::are_equal(0u, deserialize_(target, buffer.data(), buffer.size() - 1));
+    }
+
+    void test_method_(corrupted_lengths) {
+      auto source = make_person();
+      std::vector<unsigned char> buffer(serialized_size_(source));
+      serialize_(source, buffer.data(), buffer.size());
+      auto corrupt = [&](std::size_t offset) {
+        auto copy = buffer;
+        copy.insert(copy.begin() + offset, 9, 0xff);
+        copy[offset + 9] = 0x01;
+        return copy;
+      };
+      auto scores = 1 + 3 + sizeof(int) + sizeof(double);
+      auto tags = scores + 1 + 3 * sizeof(int);
+      for (auto offset : {std::size_t {0}, scores, tags}) {
+        auto corrupted = corrupt(offset);
+        person target;
+        assert::are_equal(0u, deserialize_(target, corrupted.data(), corrupted.size()));
+
+        unsigned char read_buffer[16];
+        auto position = std::size_t {0};
+        property_stream_reader_ reader(read_buffer, sizeof(read_buffer), [&](void* data, std::size_t size) {
+          auto count = std::min(size, corrupted.size() - position);
+          std::copy_n(corrupted.data() + position, count, static_cast<unsigned char*>(data));
+          position += count;
+          return count;
+        });
+        assert::is_false(reader.read(target));
+      }
+    }
+
+    void test_method_(bool_and_enum_values) {
+      settings source;
+      source.enabled = true;
+      source.background = color::blue;
+      source.palette = std::vector<color> {color::green, color::red};
+      std::vector<unsigned char> buffer(serialized_size_(source));
+      serialize_(source, buffer.data(), buffer.size());
+      settings target;
+      assert::are_equal(buffer.size(), deserialize_(target, buffer.data(), buffer.size()));
+      assert::is_true(target.enabled());
+      assert::is_true(target.background() == color::blue);
+      assert::are_equal(2u, target.palette().size());
+      assert::is_true(target.palette()[0] == color::green);
+
+      buffer[0] = 2;
+      assert::are_equal(0u, deserialize_(target, buffer.data(), buffer.size()));
+    }
+
+    void test_method_(stream_many_objects_through_small_buffer) {
+      std::string stream;
+      unsigned char write_buffer[64];
+      {
+        property_stream_writer_ writer(write_buffer, sizeof(write_buffer), [&](const void* data, std::size_t size) {
+          stream.append(static_cast<const char*>(data), size);
+          return true;
+        });
+        auto source = make_person();
+        for (auto index = 0; index < 100; ++index)
+          assert::is_true(writer.write(source));
+      }
+      assert::are_equal(100 * serialized_size_(make_person()), stream.size());
+
+      unsigned char read_buffer[48];
+      auto offset = std::size_t {0};
+      property_stream_reader_ reader(read_buffer, sizeof(read_buffer), [&](void* data, std::size_t size) {
+        auto count = std::min(size, stream.size() - offset);
+        stream.copy(static_cast<char*>(data), count, offset);
+        offset += count;
+        return count;
+      });
+      auto count = 0;
+      person target;
+      while (reader.read(target)) {
+        check(target);
+        ++count;
+      }
+      assert::are_equal(100, count);
+    }
+  };
+}
@@ -0,0 +1,70 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_snapshot_property) {
+  public:
+    void test_method_(get_and_set) {
+      property_<std::string, snapshot_> value {"Default"};
+      assert::are_equal("Default", value.get().get());
+      value = "Test property";
+      assert::is_true(value == "Test property");
+      std::string copy = value();
+      assert::are_equal("Test property", copy);
+    }
+
+    void test_method_(snapshot_outlives_write) {
+      property_<std::string, snapshot_> value {"First"};
+      auto snapshot = value.get();
+      value = "Second";
+      assert::are_equal("First", *snapshot);
+      assert::are_equal("Second", *value.get());
+    }
+
+    void test_method_(modify_and_compound_operators) {
+      property_<std::vector<int>, snapshot_> items;
+      items.modify([](std::vector<int>& items) {items.push_back(42);});
+      items.emplace(3u, 24);
+      assert::are_equal(3u, items()->size());
+
+      property_<std::string, snapshot_> text {"Test"};
+      text += " property";
+      assert::are_equal("Test property", text.get().get());
+    }
+
+    void test_method_(concurrent_readers_and_writer) {
+      property_<std::vector<int>, snapshot_> value {std::vector<int>(64, 0)};
+      property_<bool, snapshot_> running {true};
+      auto torn = 0;
+      std::vector<std::thread> readers;
+      for (auto thread = 0; thread < 3; ++thread)
+        readers.emplace_back([&] {
+          while (*running()) {
+            auto snapshot = value();
+            for (auto item : *snapshot)
+              if (item != snapshot->front()) ++torn;
+          }
+        });
+      for (auto index = 1; index < 2000; ++index)
+        value = std::vector<int>(64, index);
+      running = false;
+      for (auto& reader : readers) reader.join();
+      assert::are_equal(0, torn);
+    }
+
+    void test_method_(concurrent_modify_keeps_all_updates) {
+      property_<int, snapshot_> value;
+      std::vector<std::thread> writers;
+      for (auto thread = 0; thread < 4; ++thread)
+        writers.emplace_back([&] {for (auto index = 0; index < 1000; ++index) value += 1;});
+      for (auto& writer : writers) writer.join();
+      assert::are_equal(4000, *value.get());
+    }
+  };
+}
@@ -0,0 +1,139 @@
+#include <xtd/xtd.properties>
+#include <xtd/xtd.tunit>
+#include <string>
+#include <vector>
+
+using namespace xtd;
+using namespace xtd::tunit;
+
+namespace unit_tests {
+  class test_class_(test_tracked_property) {
+    class player {
+    public:
+      property_dirty_set_<> changes;
+      property_<std::string, tracked_> name {changes, "player"};
+      property_<int, tracked_> score {changes};
+      property_<std::vector<int>, tracked_> items {changes};
+      property_<int> level {1};
+
+      reflect_properties_(player, name, level, score, items);
+    };
+
+    class wide {
+    public:
+      property_dirty_set_<> changes;
+      property_<int, tracked_> p00 {changes}, p01 {changes}, p02 {changes}, p03 {changes}, p04 {changes}, p05 {changes}, p06 {changes}, p07 {changes};
+      property_<int, tracked_> p08 {changes}, p09 {changes}, p10 {changes}, p11 {changes}, p12 {changes}, p13 {changes}, p14 {changes}, p15 {changes};
+      property_<int, tracked_> p16 {changes}, p17 {changes}, p18 {changes}, p19 {changes}, p20 {changes}, p21 {changes}, p22 {changes}, p23 {changes};
+      property_<int, tracked_> p24 {changes}, p25 {changes}, p26 {changes}, p27 {changes}, p28 {changes}, p29 {changes}, p30 {changes}, p31 {changes};
+      property_<int, tracked_> p32 {changes}, p33 {changes}, p34 {changes}, p35 {changes}, p36 {changes}, p37 {changes}, p38 {changes}, p39 {changes};
+      property_<int, tracked_> p40 {changes}, p41 {changes}, p42 {changes}, p43 {changes}, p44 {changes}, p45 {changes}, p46 {changes}, p47 {changes};
+      property_<int, tracked_> p48 {changes}, p49 {changes}, p50 {changes}, p51 {changes};
+
+      reflect_properties_(wide, p00, p01, p02, p03, p04, p05, p06, p07, p08, p09, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51);
+    };
+
+  public:
+    void test_method_(writes_mark_the_property_dirty) {
+      player p;
+      assert::is_false(p.changes.any());
+      assert::are_equal(3u, p.changes.size());
+      p.score = 10;
+      p.name.modify([](std::string& name) {name += "1";});
+      assert::is_true(p.score.is_dirty());
+      assert::is_true(p.name.is_dirty());
+      assert::is_false(p.items.is_dirty());
+      assert::are_equal(2u, p.changes.count());
+      p.score += 5;
+      assert::are_equal(15, p.score());
+      assert::are_equal(2u, p.changes.count());
+    }
+
+    void test_method_(take_returns_the_dirty_bits_and_clears_them) {
+      player p;
+      p.items = std::vector<int> {1, 2};
+      auto dirty = p.changes.take();
+      assert::is_true(dirty.test(p.items.index()));
+      assert::is_false(dirty.test(p.score.index()));
+      assert::are_equal(1u, dirty.count());
+      assert::is_false(p.changes.any());
+      assert::is_false(p.items.is_dirty());
+      p.changes.mark(dirty);
+      assert::is_true(p.items.is_dirty());
+    }
+
+    void test_method_(for_each_dirty_property_visits_only_dirty_properties) {
+      player p;
+      p.score = 3;
+      auto names = std::string {};
+      for_each_dirty_property_(p, p.changes.take(), [&](auto descriptor, auto&) {names += std::string(descriptor.name) + ";";});
+      assert::are_equal("score;", names);
+    }
+
+    void test_method_(delta_transfers_only_dirty_properties) {
+      player source, replica;
+      source.name = "alice";
+      source.items.modify([](std::vector<int>& items) {items.push_back(7);});
+      source.level = 5;
+      auto dirty = source.changes.take();
+      std::vector<unsigned char> buffer(serialized_delta_size_(source, dirty));
+      assert::are_equal(buffer.size(), serialize_delta_(source, dirty, buffer.data(), buffer.size()));
+      assert::are_equal(buffer.size(), deserialize_delta_(replica, buffer.data(), buffer.size()));
+      assert::are_equal("alice", replica.name());
+      assert::are_equal(1u, replica.items().size());
+      assert::are_equal(0, replica.score());
+      assert::are_equal(1, replica.level());
+      assert::is_false(replica.changes.any());
+    }
+
+    void test_method_(mark_all_gives_a_full_delta) {
+      player source, replica;
+      source.changes.mark_all();
+      auto dirty = source.changes.take();
+      assert::are_equal(3u, dirty.count());
+      unsigned char buffer[64];
+      auto size = serialize_delta_(source, dirty, buffer, sizeof(buffer));
+      assert::are_equal(size, deserialize_delta_(replica, buffer, size));
+      assert::are_equal("player", replica.name());
+    }
+
+    void test_method_(truncated_or_invalid_delta_is_rejected) {
+      player source, replica;
+      source.score = 42;
+      auto dirty = source.changes.take();
+      unsigned char buffer[16];
+      auto size = serialize_delta_(source, dirty, buffer, sizeof(buffer));
+      assert::are_equal(0u, serialize_delta_(source, dirty, buffer, size - 1));
+      assert::are_equal(0u, deserialize_delta_(replica, buffer, size - 1));
+      buffer[1] = 1; // The index of level, a property_ that is not tracked.
+      assert::are_equal(0u, deserialize_delta_(replica, buffer, size));
+    }
+
+    void test_method_(delta_of_a_wide_owner_is_small) {
+      wide source, replica;
+      assert::are_equal(52u, property_count_<wide>);
+      source.p07 = 1;
+      source.p49 = 2;
+      auto dirty = source.changes.take();
+      std::vector<unsigned char> full(serialized_size_(source));
+      std::vector<unsigned char> delta(serialized_delta_size_(source, dirty));
+      assert::are_equal(208u, full.size());
+      assert::are_equal(11u, delta.size());
+      serialize_delta_(source, dirty, delta.data(), delta.size());
+      deserialize_delta_(replica, delta.data(), delta.size());
+      assert::are_equal(1, replica.p07());
+      assert::are_equal(2, replica.p49());
+      assert::are_equal(0, replica.p48());
+    }
+
+    void test_method_(property_beyond_capacity_is_not_tracked) {
+      property_dirty_set_<1> changes;
+      property_<int, tracked_> first {changes};
+      property_<int, tracked_> second {changes};
+      second = 1;
+      assert::is_true(first.is_tracked());
+      assert::is_false(second.is_tracked());
+      assert::is_false(changes.any());
+    }
+  };
+}
@@ -1,5 +1,7 @@
 #include <xtd/properties>
 #include <xtd/xtd.tunit>
+#include <memory>
+#include <string>
 
 using namespace xtd;
 using namespace xtd::tunit;